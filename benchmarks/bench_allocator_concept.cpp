@@ -0,0 +1,110 @@
+#include <benchmark/benchmark.h>
+#include "allocator_concept.h"
+#include "allocator_context.h"
+#include "pool_allocator.h"
+#include <memory_resource>
+#include <vector>
+
+using namespace fast_alloc;
+
+namespace
+{
+    constexpr std::size_t block_size = 64;
+    constexpr std::size_t block_count = 1024;
+
+    /** @brief The same pool exposed as a polymorphic memory resource. */
+    class PoolResource final : public std::pmr::memory_resource
+    {
+    public:
+        explicit PoolResource(LeanPoolAllocator& pool) noexcept
+            : pool_(pool)
+        {
+        }
+
+    private:
+        LeanPoolAllocator& pool_;
+
+        void* do_allocate(const std::size_t bytes, const std::size_t alignment) override
+        {
+            void* ptr = fast_alloc::allocate(pool_, bytes, alignment);
+            if (!ptr)
+            {
+                throw std::bad_alloc();
+            }
+            return ptr;
+        }
+
+        void do_deallocate(void* ptr, const std::size_t bytes, const std::size_t alignment) override
+        {
+            fast_alloc::deallocate(pool_, ptr, bytes, alignment);
+        }
+
+        [[nodiscard]] bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override
+        {
+            return this == &other;
+        }
+    };
+
+    /** @brief Allocate and free a batch of blocks; identical work for every dispatch style. */
+    template <typename Allocate, typename Deallocate>
+    void churn(benchmark::State& state, Allocate allocate, Deallocate deallocate)
+    {
+        std::vector<void*> blocks(block_count);
+
+        for (auto _ : state)
+        {
+            for (auto& block : blocks)
+            {
+                block = allocate();
+            }
+            benchmark::DoNotOptimize(blocks.data());
+            for (void* block : blocks)
+            {
+                deallocate(block);
+            }
+        }
+
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * block_count));
+    }
+}
+
+// Statically dispatched: generic code constrained on the concept, fully inlined
+static void BM_Dispatch_Concept(benchmark::State& state)
+{
+    LeanPoolAllocator pool(block_size, block_count);
+
+    churn(state,
+          [&] { return fast_alloc::allocate(pool, block_size); },
+          [&](void* ptr) { fast_alloc::deallocate(pool, ptr, block_size); });
+}
+
+BENCHMARK(BM_Dispatch_Concept);
+
+// Type-erased: object pointer plus inline function pointers
+static void BM_Dispatch_AllocatorHandle(benchmark::State& state)
+{
+    LeanPoolAllocator pool(block_size, block_count);
+    AllocatorHandle handle = AllocatorHandle::of(pool);
+    benchmark::DoNotOptimize(handle); // Hide the targets so the calls stay indirect
+
+    churn(state,
+          [&] { return handle.allocate(block_size); },
+          [&](void* ptr) { handle.deallocate(ptr, block_size); });
+}
+
+BENCHMARK(BM_Dispatch_AllocatorHandle);
+
+// Virtual dispatch through std::pmr::memory_resource
+static void BM_Dispatch_PmrResource(benchmark::State& state)
+{
+    LeanPoolAllocator pool(block_size, block_count);
+    PoolResource pool_resource(pool);
+    std::pmr::memory_resource* resource = &pool_resource;
+    benchmark::DoNotOptimize(resource); // Prevent devirtualisation
+
+    churn(state,
+          [&] { return resource->allocate(block_size); },
+          [&](void* ptr) { resource->deallocate(ptr, block_size); });
+}
+
+BENCHMARK(BM_Dispatch_PmrResource);
@@ -0,0 +1,35 @@
+#include <benchmark/benchmark.h>
+#include "pool_allocator.h"
+#include "threadsafe_pool_allocator.h"
+#include <vector>
+
+using namespace fast_alloc;
+
+// Allocate a batch of blocks and free them again; the per-block cost of each configuration
+template <typename Pool>
+static void BM_PoolConfig_BatchAllocFree(benchmark::State& state)
+{
+    constexpr std::size_t block_count = 1024;
+    Pool pool(64, block_count);
+    std::vector<void*> blocks(block_count);
+
+    for (auto _ : state)
+    {
+        for (auto& block : blocks)
+        {
+            block = pool.allocate();
+        }
+        benchmark::DoNotOptimize(blocks.data());
+        for (void* block : blocks)
+        {
+            pool.deallocate(block);
+        }
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * block_count));
+}
+
+BENCHMARK(BM_PoolConfig_BatchAllocFree<LeanPoolAllocator>)->Name("BM_PoolConfig_BatchAllocFree/Lean");
+BENCHMARK(BM_PoolConfig_BatchAllocFree<PoolAllocator>)->Name("BM_PoolConfig_BatchAllocFree/Default");
+BENCHMARK(BM_PoolConfig_BatchAllocFree<CheckedPoolAllocator>)->Name("BM_PoolConfig_BatchAllocFree/Checked");
+BENCHMARK(BM_PoolConfig_BatchAllocFree<ThreadSafePoolAllocator>)->Name("BM_PoolConfig_BatchAllocFree/ThreadSafe");
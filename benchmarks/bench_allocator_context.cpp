@@ -0,0 +1,95 @@
+#include <benchmark/benchmark.h>
+#include "allocator_context.h"
+#include "stack_allocator.h"
+#include <cstdlib>
+#include <vector>
+
+using namespace fast_alloc;
+
+static void BM_StackAllocator_Direct(benchmark::State& state)
+{
+    StackAllocator stack(1024 * 1024);
+
+    for (auto _ : state)
+    {
+        void* ptr = stack.allocate(32);
+        benchmark::DoNotOptimize(ptr);
+        if (stack.available() < 64) stack.reset();
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+
+BENCHMARK(BM_StackAllocator_Direct);
+
+// Same arena reached through the thread-local context instead of a reference
+static void BM_StackAllocator_ViaContext(benchmark::State& state)
+{
+    StackAllocator stack(1024 * 1024);
+    AllocatorScope scope(stack);
+
+    for (auto _ : state)
+    {
+        void* ptr = context_allocate(32);
+        benchmark::DoNotOptimize(ptr);
+        if (stack.available() < 64) stack.reset();
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+
+BENCHMARK(BM_StackAllocator_ViaContext);
+
+static void BM_Malloc_ContextBaseline(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        void* ptr = std::malloc(32);
+        benchmark::DoNotOptimize(ptr);
+        std::free(ptr);
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+
+BENCHMARK(BM_Malloc_ContextBaseline);
+
+static void BM_ContextAllocator_Vector(benchmark::State& state)
+{
+    StackAllocator stack(1024 * 1024);
+    AllocatorScope scope(stack);
+
+    for (auto _ : state)
+    {
+        {
+            std::vector<int, ContextAllocator<int>> values;
+            for (int i = 0; i < 100; ++i)
+            {
+                values.push_back(i);
+            }
+            benchmark::DoNotOptimize(values.data());
+        }
+        stack.reset();
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * 100));
+}
+
+BENCHMARK(BM_ContextAllocator_Vector);
+
+static void BM_StdAllocator_Vector(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        std::vector<int> values;
+        for (int i = 0; i < 100; ++i)
+        {
+            values.push_back(i);
+        }
+        benchmark::DoNotOptimize(values.data());
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * 100));
+}
+
+BENCHMARK(BM_StdAllocator_Vector);
@@ -0,0 +1,380 @@
+#include <benchmark/benchmark.h>
+#include "allocator_concept.h"
+#include "binned_arena_allocator.h"
+#include "freelist_allocator.h"
+#include "inline_arena.h"
+#include "pool_allocator.h"
+#include "stack_allocator.h"
+#include "threadsafe_pool_allocator.h"
+#include "tiny_pool_allocator.h"
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstdlib>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+#ifdef _WIN32
+#include <malloc.h>
+#endif
+
+// Every allocator in MatrixAllocators runs the same scenarios: each size x alignment x free
+// order, single-threaded and with several threads. One iteration allocates a batch of blocks,
+// touches each, and frees them in the scenario's order, so results are comparable across rows.
+//
+// To cover a new allocator, specialise MatrixTraits for it and add it to MatrixAllocators.
+// Filter with e.g. --benchmark_filter='BM_Matrix<.*>/size:64/' or '/align:4096/'.
+
+using namespace fast_alloc;
+
+namespace
+{
+    constexpr std::size_t matrix_sizes[] = {8, 64, 512, 4096, 64 * 1024, 1024 * 1024};
+    constexpr std::size_t matrix_alignments[] = {8, 64, 4096};
+    constexpr int matrix_threads[] = {1, 4};
+
+    constexpr std::size_t max_batch_count = 256;
+    constexpr std::size_t max_batch_bytes = 4 * 1024 * 1024;
+
+    enum class FreeOrder { Lifo, Fifo, Random };
+
+    /**
+     * @brief One cell of the matrix, for one thread.
+     */
+    struct Scenario
+    {
+        std::size_t size;
+        std::size_t alignment;
+        std::size_t count;  ///< Blocks allocated per iteration
+        FreeOrder order;
+        std::size_t users; ///< Threads allocating from one instance
+
+        /** @brief Worst-case bytes for count blocks, including alignment padding. */
+        [[nodiscard]] std::size_t footprint() const noexcept { return users * count * (size + alignment); }
+    };
+
+    /** @brief Baseline: the system heap through the same interface. */
+    class MallocAllocator
+    {
+    public:
+        void* allocate(const std::size_t size, const std::size_t alignment = alignof(std::max_align_t))
+        {
+            // aligned_alloc wants a multiple of the alignment
+            const std::size_t rounded = (size + alignment - 1) & ~(alignment - 1);
+#ifdef _WIN32
+            return _aligned_malloc(rounded, alignment);
+#else
+            return std::aligned_alloc(alignment, rounded);
+#endif
+        }
+
+        void deallocate(void* ptr, std::size_t, std::size_t)
+        {
+#ifdef _WIN32
+            _aligned_free(ptr);
+#else
+            std::free(ptr);
+#endif
+        }
+    };
+
+    /**
+     * @brief How the matrix builds and recycles an allocator.
+     *
+     * Specialisations provide:
+     *  - name: row label
+     *  - shared: thread-safe, so threads share one instance (otherwise each thread gets its own)
+     *  - frees: deallocate() reclaims memory (otherwise free orders are equivalent; only LIFO runs)
+     *  - supports(scenario): whether the allocator can serve the scenario at all
+     *  - make(scenario): an instance sized for the scenario
+     *  - recycle(allocator): called after every batch (arenas reset here)
+     */
+    template <typename A>
+    struct MatrixTraits;
+
+    /** @brief Defaults for allocators that serve any scenario and need no recycling. */
+    struct GeneralTraits
+    {
+        static constexpr bool shared = false;
+        static constexpr bool frees = true;
+
+        static bool supports(const Scenario&) noexcept { return true; }
+
+        template <typename A>
+        static void recycle(A&) noexcept
+        {
+        }
+    };
+
+    template <>
+    struct MatrixTraits<MallocAllocator> : GeneralTraits
+    {
+        static constexpr const char* name = "malloc";
+        static constexpr bool shared = true;
+
+        static std::unique_ptr<MallocAllocator> make(const Scenario&) { return std::make_unique<MallocAllocator>(); }
+    };
+
+    template <>
+    struct MatrixTraits<PoolAllocator> : GeneralTraits
+    {
+        static constexpr const char* name = "PoolAllocator";
+
+        static std::unique_ptr<PoolAllocator> make(const Scenario& scenario)
+        {
+            return std::make_unique<PoolAllocator>(std::max(scenario.size, sizeof(void*)),
+                                                   scenario.users * scenario.count,
+                                                   std::max(scenario.alignment, alignof(void*)));
+        }
+    };
+
+    template <>
+    struct MatrixTraits<ThreadSafePoolAllocator> : GeneralTraits
+    {
+        static constexpr const char* name = "ThreadSafePoolAllocator";
+        static constexpr bool shared = true;
+
+        static std::unique_ptr<ThreadSafePoolAllocator> make(const Scenario& scenario)
+        {
+            return std::make_unique<ThreadSafePoolAllocator>(std::max(scenario.size, sizeof(void*)),
+                                                             scenario.users * scenario.count,
+                                                             std::max(scenario.alignment, alignof(void*)));
+        }
+    };
+
+    template <>
+    struct MatrixTraits<TinyPoolAllocator> : GeneralTraits
+    {
+        static constexpr const char* name = "TinyPoolAllocator";
+
+        // Tiny blocks only, aligned no further than their packed stride allows
+        static bool supports(const Scenario& scenario) noexcept
+        {
+            const std::size_t stride_alignment = std::min(std::size_t{1} << std::countr_zero(scenario.size),
+                                                          alignof(std::max_align_t));
+            return scenario.size <= 64 && scenario.alignment <= stride_alignment;
+        }
+
+        static std::unique_ptr<TinyPoolAllocator> make(const Scenario& scenario)
+        {
+            return std::make_unique<TinyPoolAllocator>(scenario.size, scenario.users * scenario.count);
+        }
+    };
+
+    template <>
+    struct MatrixTraits<FreeListAllocator> : GeneralTraits
+    {
+        static constexpr const char* name = "FreeListAllocator";
+
+        static std::unique_ptr<FreeListAllocator> make(const Scenario& scenario)
+        {
+            // Room for the per-block header on top of size and padding
+            return std::make_unique<FreeListAllocator>(scenario.footprint() + scenario.users * scenario.count * 64);
+        }
+    };
+
+    template <>
+    struct MatrixTraits<BinnedArenaAllocator> : GeneralTraits
+    {
+        static constexpr const char* name = "BinnedArenaAllocator";
+
+        static std::unique_ptr<BinnedArenaAllocator> make(const Scenario& scenario)
+        {
+            // Size classes round up to a power of 2
+            return std::make_unique<BinnedArenaAllocator>(2 * scenario.footprint());
+        }
+
+        // Large and over-aligned chunks are only reclaimed by reset()
+        static void recycle(BinnedArenaAllocator& arena) noexcept { arena.reset(); }
+    };
+
+    template <>
+    struct MatrixTraits<StackAllocator> : GeneralTraits
+    {
+        static constexpr const char* name = "StackAllocator";
+        static constexpr bool frees = false;
+
+        static std::unique_ptr<StackAllocator> make(const Scenario& scenario)
+        {
+            return std::make_unique<StackAllocator>(scenario.footprint());
+        }
+
+        static void recycle(StackAllocator& stack) { stack.reset(); }
+    };
+
+    using MatrixInlineArena = InlineArena<4096>;
+
+    template <>
+    struct MatrixTraits<MatrixInlineArena> : GeneralTraits
+    {
+        static constexpr const char* name = "InlineArena<4096>";
+        static constexpr bool frees = false;
+
+        static std::unique_ptr<MatrixInlineArena> make(const Scenario& scenario)
+        {
+            // Batches beyond the inline buffer spill into a single chunk
+            return std::make_unique<MatrixInlineArena>(scenario.footprint());
+        }
+
+        static void recycle(MatrixInlineArena& arena) { arena.reset(); }
+    };
+
+    using MatrixAllocators = std::tuple<MallocAllocator,
+                                        PoolAllocator,
+                                        ThreadSafePoolAllocator,
+                                        TinyPoolAllocator,
+                                        FreeListAllocator,
+                                        BinnedArenaAllocator,
+                                        StackAllocator,
+                                        MatrixInlineArena>;
+
+    /** @brief Order in which a batch of @p count blocks is freed. */
+    std::vector<std::size_t> free_order(const FreeOrder order, const std::size_t count, const unsigned seed)
+    {
+        std::vector<std::size_t> indices(count);
+        std::iota(indices.begin(), indices.end(), std::size_t{0});
+
+        switch (order)
+        {
+        case FreeOrder::Lifo:
+            std::reverse(indices.begin(), indices.end());
+            break;
+        case FreeOrder::Fifo:
+            break;
+        case FreeOrder::Random:
+            std::shuffle(indices.begin(), indices.end(), std::mt19937(seed));
+            break;
+        }
+        return indices;
+    }
+
+    template <typename A>
+    void run_scenario(benchmark::State& state, const Scenario& scenario, std::atomic<A*>& shared_instance)
+    {
+        using Traits = MatrixTraits<A>;
+
+        // Shared instances are built by thread 0; the others wait for it
+        std::unique_ptr<A> owned;
+        A* allocator = nullptr;
+        if (!Traits::shared || state.thread_index() == 0)
+        {
+            owned = Traits::make(scenario);
+            allocator = owned.get();
+            if (Traits::shared)
+            {
+                shared_instance.store(allocator, std::memory_order_release);
+            }
+        }
+        else
+        {
+            while (!(allocator = shared_instance.load(std::memory_order_acquire)))
+            {
+                std::this_thread::yield();
+            }
+        }
+
+        const std::vector<std::size_t> order =
+            free_order(scenario.order, scenario.count, 42u + static_cast<unsigned>(state.thread_index()));
+        std::vector<void*> blocks(scenario.count);
+
+        for (auto _ : state)
+        {
+            for (std::size_t i = 0; i < scenario.count; ++i)
+            {
+                void* ptr = fast_alloc::allocate(*allocator, scenario.size, scenario.alignment);
+                if (ptr)
+                {
+                    static_cast<char*>(ptr)[0] = static_cast<char>(i);
+                }
+                blocks[i] = ptr; // deallocate() ignores nullptr
+            }
+            benchmark::DoNotOptimize(blocks.data());
+
+            if (std::find(blocks.begin(), blocks.end(), nullptr) != blocks.end())
+            {
+                state.SkipWithError("Allocation failed: allocator sized too small for the scenario");
+            }
+
+            for (const std::size_t index : order)
+            {
+                fast_alloc::deallocate(*allocator, blocks[index], scenario.size, scenario.alignment);
+            }
+            Traits::recycle(*allocator);
+        }
+
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * scenario.count));
+
+        // The loop ends with a barrier, so no thread still uses the shared instance
+        if (Traits::shared && state.thread_index() == 0)
+        {
+            shared_instance.store(nullptr, std::memory_order_relaxed);
+        }
+    }
+
+    const char* order_name(const FreeOrder order) noexcept
+    {
+        switch (order)
+        {
+        case FreeOrder::Lifo: return "LIFO";
+        case FreeOrder::Fifo: return "FIFO";
+        case FreeOrder::Random: return "Random";
+        }
+        return "";
+    }
+
+    template <typename A>
+    void register_allocator()
+    {
+        using Traits = MatrixTraits<A>;
+        static_assert(Allocator<A>, "Matrix allocators must satisfy fast_alloc::Allocator");
+
+        static std::atomic<A*> shared_instance{nullptr};
+
+        for (const std::size_t size : matrix_sizes)
+        {
+            for (const std::size_t alignment : matrix_alignments)
+            {
+                for (const FreeOrder order : {FreeOrder::Lifo, FreeOrder::Fifo, FreeOrder::Random})
+                {
+                    if (!Traits::frees && order != FreeOrder::Lifo)
+                    {
+                        continue; // Freed by recycle(): every order is the same
+                    }
+
+                    for (const int threads : matrix_threads)
+                    {
+                        const std::size_t count = std::clamp(max_batch_bytes / size, std::size_t{1}, max_batch_count);
+                        const Scenario scenario{size, alignment, count, order,
+                                                Traits::shared ? static_cast<std::size_t>(threads) : 1};
+                        if (!Traits::supports(scenario))
+                        {
+                            continue;
+                        }
+
+                        const std::string name = std::string("BM_Matrix<") + Traits::name + ">/size:" +
+                            std::to_string(size) + "/align:" + std::to_string(alignment) + "/" + order_name(order);
+
+                        benchmark::RegisterBenchmark(name.c_str(), [scenario](benchmark::State& state)
+                        {
+                            run_scenario<A>(state, scenario, shared_instance);
+                        })->Threads(threads)->UseRealTime();
+                    }
+                }
+            }
+        }
+    }
+
+    template <typename... Allocators>
+    bool register_matrix(std::tuple<Allocators...>*)
+    {
+        (register_allocator<Allocators>(), ...);
+        return true;
+    }
+
+    const bool matrix_registered = register_matrix(static_cast<MatrixAllocators*>(nullptr));
+}
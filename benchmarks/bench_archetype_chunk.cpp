@@ -0,0 +1,110 @@
+#include <benchmark/benchmark.h>
+#include "archetype_chunk_allocator.h"
+#include "pool_allocator.h"
+#include <new>
+#include <vector>
+
+using namespace fast_alloc;
+
+namespace
+{
+    struct Position
+    {
+        float x, y, z;
+    };
+
+    struct Velocity
+    {
+        float x, y, z;
+    };
+
+    struct Entity
+    {
+        Position position;
+        Velocity velocity;
+        char other_state[40];
+    };
+}
+
+static void BM_ArchetypeChunk_Integrate(benchmark::State& state)
+{
+    const auto count = static_cast<std::size_t>(state.range(0));
+    ArchetypeChunkAllocator archetype({component_layout<Position>(), component_layout<Velocity>()}, 1024);
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        const std::size_t row = archetype.create();
+        *archetype.component<Position>(row, 0) = {0.0f, 0.0f, 0.0f};
+        *archetype.component<Velocity>(row, 1) = {1.0f, 2.0f, 3.0f};
+    }
+
+    for (auto _ : state)
+    {
+        for (std::size_t chunk = 0; chunk < archetype.chunk_count(); ++chunk)
+        {
+            auto* positions = archetype.column<Position>(chunk, 0);
+            const auto* velocities = archetype.column<Velocity>(chunk, 1);
+            const std::size_t n = archetype.chunk_entities(chunk);
+
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                positions[i].x += velocities[i].x;
+                positions[i].y += velocities[i].y;
+                positions[i].z += velocities[i].z;
+            }
+        }
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * count));
+}
+
+BENCHMARK(BM_ArchetypeChunk_Integrate)->Arg(1000)->Arg(100000);
+
+static void BM_PoolAllocator_IntegrateEntities(benchmark::State& state)
+{
+    const auto count = static_cast<std::size_t>(state.range(0));
+    PoolAllocator pool(sizeof(Entity), count);
+    std::vector<Entity*> entities;
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        entities.push_back(new (pool.allocate()) Entity{{0.0f, 0.0f, 0.0f}, {1.0f, 2.0f, 3.0f}, {}});
+    }
+
+    for (auto _ : state)
+    {
+        for (Entity* entity : entities)
+        {
+            entity->position.x += entity->velocity.x;
+            entity->position.y += entity->velocity.y;
+            entity->position.z += entity->velocity.z;
+        }
+        benchmark::ClobberMemory();
+    }
+
+    for (Entity* entity : entities)
+    {
+        pool.deallocate(entity);
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * count));
+}
+
+BENCHMARK(BM_PoolAllocator_IntegrateEntities)->Arg(1000)->Arg(100000);
+
+static void BM_ArchetypeChunk_CreateDestroy(benchmark::State& state)
+{
+    ArchetypeChunkAllocator archetype({component_layout<Position>(), component_layout<Velocity>()}, 64);
+
+    for (auto _ : state)
+    {
+        const std::size_t row = archetype.create();
+        benchmark::DoNotOptimize(row);
+        archetype.destroy(row);
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+
+BENCHMARK(BM_ArchetypeChunk_CreateDestroy);
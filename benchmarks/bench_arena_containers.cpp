@@ -0,0 +1,96 @@
+#include <benchmark/benchmark.h>
+#include "arena_containers.h"
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+using namespace fast_alloc;
+
+// One simulated request: collect IDs into a vector and count them in a map, then throw both away
+static void BM_Request_StdContainers(benchmark::State& state)
+{
+    const auto count = static_cast<std::uint32_t>(state.range(0));
+
+    for (auto _ : state)
+    {
+        std::vector<std::uint32_t> ids;
+        std::unordered_map<std::uint32_t, std::uint32_t> counts;
+        for (std::uint32_t i = 0; i < count; ++i)
+        {
+            const std::uint32_t id = (i * 2654435761u) % (count / 4 + 1);
+            ids.push_back(id);
+            ++counts[id];
+        }
+        benchmark::DoNotOptimize(ids.data());
+        benchmark::DoNotOptimize(counts.size());
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * count));
+}
+
+BENCHMARK(BM_Request_StdContainers)->Arg(64)->Arg(1024)->Arg(16384);
+
+static void BM_Request_ArenaContainers(benchmark::State& state)
+{
+    const auto count = static_cast<std::uint32_t>(state.range(0));
+    StackAllocator arena(4 * 1024 * 1024);
+
+    for (auto _ : state)
+    {
+        {
+            ArenaHashMap<std::uint32_t, std::uint32_t> counts(arena);
+            ArenaVector<std::uint32_t> ids(arena);
+            for (std::uint32_t i = 0; i < count; ++i)
+            {
+                const std::uint32_t id = (i * 2654435761u) % (count / 4 + 1);
+                ids.push_back(id);
+                ++*counts.insert(id, 0).first;
+            }
+            benchmark::DoNotOptimize(ids.data());
+            benchmark::DoNotOptimize(counts.size());
+        }
+        arena.reset();
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * count));
+}
+
+BENCHMARK(BM_Request_ArenaContainers)->Arg(64)->Arg(1024)->Arg(16384);
+
+// Reusing one map across requests: clear() is O(1) instead of visiting every node
+static void BM_MapClear_Std(benchmark::State& state)
+{
+    std::unordered_map<std::uint32_t, std::uint32_t> counts;
+
+    for (auto _ : state)
+    {
+        for (std::uint32_t i = 0; i < 1024; ++i)
+        {
+            counts[i] = i;
+        }
+        counts.clear();
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * 1024));
+}
+
+BENCHMARK(BM_MapClear_Std);
+
+static void BM_MapClear_Arena(benchmark::State& state)
+{
+    StackAllocator arena(1024 * 1024);
+    ArenaHashMap<std::uint32_t, std::uint32_t> counts(arena, 1024);
+
+    for (auto _ : state)
+    {
+        for (std::uint32_t i = 0; i < 1024; ++i)
+        {
+            counts.insert_or_assign(i, i);
+        }
+        counts.clear();
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * 1024));
+}
+
+BENCHMARK(BM_MapClear_Arena);
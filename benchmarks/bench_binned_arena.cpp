@@ -0,0 +1,98 @@
+#include <benchmark/benchmark.h>
+#include "binned_arena_allocator.h"
+#include "freelist_allocator.h"
+#include <algorithm>
+#include <cstdlib>
+#include <vector>
+
+using namespace fast_alloc;
+
+namespace
+{
+    constexpr std::size_t live_set = 64;
+    constexpr std::size_t churn_ops = 10000;
+
+    std::size_t churn_size(const std::size_t i)
+    {
+        return 16 + (i * 37) % 500;
+    }
+}
+
+static void BM_BinnedArena_FrameChurn(benchmark::State& state)
+{
+    BinnedArenaAllocator arena(4 * 1024 * 1024);
+    std::vector<void*> ptrs(live_set, nullptr);
+    std::vector<std::size_t> sizes(live_set, 0);
+
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0; i < churn_ops; ++i)
+        {
+            const std::size_t slot = (i * 7) % live_set;
+            arena.deallocate(ptrs[slot], sizes[slot]);
+            sizes[slot] = churn_size(i);
+            ptrs[slot] = arena.allocate(sizes[slot]);
+        }
+        benchmark::DoNotOptimize(ptrs.data());
+
+        arena.reset();
+        std::fill(ptrs.begin(), ptrs.end(), nullptr);
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * churn_ops));
+}
+
+BENCHMARK(BM_BinnedArena_FrameChurn);
+
+static void BM_FreeList_FrameChurn(benchmark::State& state)
+{
+    FreeListAllocator allocator(4 * 1024 * 1024);
+    std::vector<void*> ptrs(live_set, nullptr);
+
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0; i < churn_ops; ++i)
+        {
+            const std::size_t slot = (i * 7) % live_set;
+            allocator.deallocate(ptrs[slot]);
+            ptrs[slot] = allocator.allocate(churn_size(i));
+        }
+        benchmark::DoNotOptimize(ptrs.data());
+
+        for (auto& ptr : ptrs)
+        {
+            allocator.deallocate(ptr);
+            ptr = nullptr;
+        }
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * churn_ops));
+}
+
+BENCHMARK(BM_FreeList_FrameChurn);
+
+static void BM_Malloc_FrameChurn(benchmark::State& state)
+{
+    std::vector<void*> ptrs(live_set, nullptr);
+
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0; i < churn_ops; ++i)
+        {
+            const std::size_t slot = (i * 7) % live_set;
+            std::free(ptrs[slot]);
+            ptrs[slot] = std::malloc(churn_size(i));
+        }
+        benchmark::DoNotOptimize(ptrs.data());
+
+        for (auto& ptr : ptrs)
+        {
+            std::free(ptr);
+            ptr = nullptr;
+        }
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * churn_ops));
+}
+
+BENCHMARK(BM_Malloc_FrameChurn);
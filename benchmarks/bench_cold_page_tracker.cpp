@@ -0,0 +1,51 @@
+#include <benchmark/benchmark.h>
+#include "cold_page_tracker.h"
+#include "pool_allocator.h"
+#include <random>
+#include <vector>
+
+using namespace fast_alloc;
+
+static void BM_ColdPageTracker_Touch(benchmark::State& state)
+{
+    PoolAllocator pool(64, 1024 * 1024);
+    ColdPageTracker tracker(pool);
+
+    std::vector<void*> blocks;
+    for (int i = 0; i < 4096; ++i)
+    {
+        blocks.push_back(pool.allocate());
+    }
+
+    std::size_t i = 0;
+    for (auto _ : state)
+    {
+        tracker.touch(blocks[i++ & 4095]);
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+
+BENCHMARK(BM_ColdPageTracker_Touch);
+
+// Scan cost of demote() over a 64 MiB pool where 1 in 8 spans stays hot
+static void BM_ColdPageTracker_DemoteScan(benchmark::State& state)
+{
+    PoolAllocator pool(64, 1024 * 1024);
+    ColdPageTracker tracker(pool, ColdPageTracker::default_span_size, 1);
+    auto* base = static_cast<std::byte*>(pool.data());
+
+    for (auto _ : state)
+    {
+        tracker.tick();
+        for (std::size_t span = 0; span < tracker.span_count(); span += 8)
+        {
+            tracker.touch(base + span * tracker.span_size() + 4096);
+        }
+        benchmark::DoNotOptimize(tracker.demote());
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * tracker.span_count()));
+}
+
+BENCHMARK(BM_ColdPageTracker_DemoteScan);
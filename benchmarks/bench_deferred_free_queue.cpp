@@ -0,0 +1,77 @@
+#include <benchmark/benchmark.h>
+#include "deferred_free_queue.h"
+#include "freelist_allocator.h"
+#include <vector>
+
+using namespace fast_alloc;
+
+namespace
+{
+    constexpr std::size_t block_count = 4096;
+    constexpr std::size_t block_size = 256;
+
+    /** @brief Allocate every block, so freeing every other one leaves a long, fragmented free list. */
+    void fill(FreeListAllocator& heap, std::vector<void*>& blocks)
+    {
+        for (auto& block : blocks)
+        {
+            block = heap.allocate(block_size);
+        }
+    }
+}
+
+// Cost seen by the real-time thread when it frees into the free list itself
+static void BM_FreeList_DirectFree(benchmark::State& state)
+{
+    FreeListAllocator heap(4 * block_count * block_size);
+    std::vector<void*> blocks(block_count);
+    fill(heap, blocks);
+
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0; i < block_count; i += 2)
+        {
+            heap.deallocate(blocks[i]);
+        }
+
+        state.PauseTiming();
+        for (std::size_t i = 0; i < block_count; i += 2)
+        {
+            blocks[i] = heap.allocate(block_size);
+        }
+        state.ResumeTiming();
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * block_count / 2));
+}
+
+BENCHMARK(BM_FreeList_DirectFree);
+
+// Same frees pushed to a deferred queue; the deallocation happens outside the timed region
+static void BM_FreeList_DeferredPush(benchmark::State& state)
+{
+    FreeListAllocator heap(4 * block_count * block_size);
+    std::vector<void*> blocks(block_count);
+    fill(heap, blocks);
+    DeferredFreeQueue deferred(heap);
+
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0; i < block_count; i += 2)
+        {
+            deferred.push(blocks[i], block_size);
+        }
+
+        state.PauseTiming();
+        deferred.drain();
+        for (std::size_t i = 0; i < block_count; i += 2)
+        {
+            blocks[i] = heap.allocate(block_size);
+        }
+        state.ResumeTiming();
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * block_count / 2));
+}
+
+BENCHMARK(BM_FreeList_DeferredPush);
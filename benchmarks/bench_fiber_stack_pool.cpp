@@ -0,0 +1,69 @@
+#include <benchmark/benchmark.h>
+#include "fiber_stack_pool.h"
+
+#ifndef _WIN32
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+using namespace fast_alloc;
+
+namespace
+{
+    constexpr std::size_t stack_size = 64 * 1024;
+}
+
+static void BM_FiberStackPool_AcquireRelease(benchmark::State& state)
+{
+    FiberStackPool pool(stack_size, 64);
+
+    for (auto _ : state)
+    {
+        void* stack = pool.allocate();
+        // Touch the top page, as a fiber entry would
+        static_cast<volatile char*>(pool.top(stack))[-1] = 1;
+        pool.deallocate(stack);
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+
+BENCHMARK(BM_FiberStackPool_AcquireRelease);
+
+static void BM_FiberStackPool_AcquireReleaseDecommit(benchmark::State& state)
+{
+    // Watermark 0: every release decommits, every acquire faults fresh pages
+    FiberStackPool pool(stack_size, 64, 0);
+
+    for (auto _ : state)
+    {
+        void* stack = pool.allocate();
+        static_cast<volatile char*>(pool.top(stack))[-1] = 1;
+        pool.deallocate(stack);
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+
+BENCHMARK(BM_FiberStackPool_AcquireReleaseDecommit);
+
+#ifndef _WIN32
+static void BM_Mmap_FiberStack(benchmark::State& state)
+{
+    const auto page_size = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+
+    for (auto _ : state)
+    {
+        // What a scheduler without a pool pays per fiber
+        void* region = mmap(nullptr, stack_size + page_size, PROT_READ | PROT_WRITE,
+                            MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        mprotect(region, page_size, PROT_NONE);
+        static_cast<volatile char*>(region)[stack_size + page_size - 1] = 1;
+        munmap(region, stack_size + page_size);
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+
+BENCHMARK(BM_Mmap_FiberStack);
+#endif
@@ -112,3 +112,47 @@ static void BM_FreeListAllocator_Fragmentation(benchmark::State& state)
 }
 
 BENCHMARK(BM_FreeListAllocator_Fragmentation);
+
+// Alloc/free ping-pong against a fragmented heap: every free walks a long free list unless deferred
+static void BM_FreeListAllocator_PingPong(benchmark::State& state)
+{
+    constexpr std::size_t allocator_size = 1024 * 1024;
+    constexpr std::size_t num_allocs = 1000;
+    FreeListAllocator allocator(allocator_size, FreeListStrategy::FirstFit);
+    if (state.range(0) > 0)
+    {
+        allocator.set_deferred_coalescing(static_cast<std::size_t>(state.range(0)));
+    }
+
+    std::vector<void*> ptrs;
+    ptrs.reserve(num_allocs);
+    for (std::size_t i = 0; i < num_allocs; ++i)
+    {
+        ptrs.push_back(allocator.allocate(64));
+    }
+    for (std::size_t i = 0; i < num_allocs; i += 2)
+    {
+        allocator.deallocate(ptrs[i]);
+    }
+    allocator.flush_deferred();
+
+    const std::vector<std::size_t> sizes = {24, 48, 96, 200};
+    std::vector<void*> live(sizes.size());
+
+    for (auto _ : state)
+    {
+        for (std::size_t i = 0; i < sizes.size(); ++i)
+        {
+            live[i] = allocator.allocate(sizes[i]);
+        }
+        benchmark::DoNotOptimize(live.data());
+        for (void* ptr : live)
+        {
+            allocator.deallocate(ptr);
+        }
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * sizes.size()));
+}
+
+BENCHMARK(BM_FreeListAllocator_PingPong)->Arg(0)->Arg(64);
@@ -0,0 +1,92 @@
+#include <benchmark/benchmark.h>
+#include "inline_arena.h"
+#include "stack_allocator.h"
+#include <cstdlib>
+
+using namespace fast_alloc;
+
+namespace
+{
+    constexpr int allocations_per_call = 16;
+    constexpr std::size_t allocation_size = 48;
+
+    // A short function needing scratch memory: allocate, touch, return
+    template <typename Arena>
+    void scratch_call(Arena& arena)
+    {
+        for (int i = 0; i < allocations_per_call; ++i)
+        {
+            void* ptr = arena.allocate(allocation_size);
+            static_cast<char*>(ptr)[0] = static_cast<char>(i);
+            benchmark::DoNotOptimize(ptr);
+        }
+    }
+}
+
+// Scratch arena on the call stack: no heap traffic while it fits
+static void BM_InlineArena_Scratch(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        InlineArena<1024> arena;
+        scratch_call(arena);
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * allocations_per_call);
+}
+
+BENCHMARK(BM_InlineArena_Scratch);
+
+// Same call overflowing a too-small inline buffer into a heap chunk
+static void BM_InlineArena_Spill(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        InlineArena<256> arena(1024);
+        scratch_call(arena);
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * allocations_per_call);
+}
+
+BENCHMARK(BM_InlineArena_Spill);
+
+// A StackAllocator per call pays for its heap buffer every time
+static void BM_StackAllocator_Scratch(benchmark::State& state)
+{
+    for (auto _ : state)
+    {
+        StackAllocator arena(1024);
+        scratch_call(arena);
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * allocations_per_call);
+}
+
+BENCHMARK(BM_StackAllocator_Scratch);
+
+static void BM_Malloc_Scratch(benchmark::State& state)
+{
+    void* ptrs[allocations_per_call];
+
+    for (auto _ : state)
+    {
+        for (int i = 0; i < allocations_per_call; ++i)
+        {
+            ptrs[i] = std::malloc(allocation_size);
+            static_cast<char*>(ptrs[i])[0] = static_cast<char>(i);
+            benchmark::DoNotOptimize(ptrs[i]);
+        }
+        for (void* ptr : ptrs)
+        {
+            std::free(ptr);
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * allocations_per_call);
+}
+
+BENCHMARK(BM_Malloc_Scratch);
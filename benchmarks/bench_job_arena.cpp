@@ -0,0 +1,96 @@
+#include <benchmark/benchmark.h>
+#include "job_arena_allocator.h"
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+using namespace fast_alloc;
+
+namespace
+{
+    constexpr int jobs_per_worker = 1024;
+    constexpr std::size_t job_data_size = 48;
+}
+
+// One iteration = one job graph: every worker allocates scratch data for its jobs, then the graph ends
+static void BM_JobArenaAllocator_Graph(benchmark::State& state)
+{
+    const auto num_threads = static_cast<std::size_t>(state.range(0));
+    JobArenaAllocator jobs(num_threads);
+
+    for (auto _ : state)
+    {
+        const JobGraph graph = jobs.begin_graph();
+
+        std::vector<std::thread> threads;
+        threads.reserve(num_threads);
+
+        for (std::size_t w = 0; w < num_threads; ++w)
+        {
+            threads.emplace_back([&jobs, graph, w]()
+            {
+                for (int i = 0; i < jobs_per_worker; ++i)
+                {
+                    void* ptr = jobs.allocate(graph, w, job_data_size);
+                    benchmark::DoNotOptimize(ptr);
+                }
+            });
+        }
+
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+
+        jobs.end_graph(graph); // No per-job frees
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * num_threads * jobs_per_worker));
+}
+
+BENCHMARK(BM_JobArenaAllocator_Graph)
+    ->Arg(1)
+    ->Arg(2)
+    ->Arg(4)
+    ->Arg(8);
+
+static void BM_Malloc_JobGraph(benchmark::State& state)
+{
+    const auto num_threads = static_cast<std::size_t>(state.range(0));
+
+    for (auto _ : state)
+    {
+        std::vector<std::thread> threads;
+        threads.reserve(num_threads);
+
+        for (std::size_t w = 0; w < num_threads; ++w)
+        {
+            threads.emplace_back([]()
+            {
+                std::vector<void*> ptrs(jobs_per_worker);
+                for (auto& ptr : ptrs)
+                {
+                    ptr = std::malloc(job_data_size);
+                    benchmark::DoNotOptimize(ptr);
+                }
+                for (void* ptr : ptrs)
+                {
+                    std::free(ptr);
+                }
+            });
+        }
+
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * num_threads * jobs_per_worker));
+}
+
+BENCHMARK(BM_Malloc_JobGraph)
+    ->Arg(1)
+    ->Arg(2)
+    ->Arg(4)
+    ->Arg(8);
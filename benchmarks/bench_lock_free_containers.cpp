@@ -0,0 +1,155 @@
+#include <benchmark/benchmark.h>
+#include "lock_free_containers.h"
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace fast_alloc;
+
+namespace
+{
+    constexpr std::uint64_t messages_per_producer = 10000;
+
+    /** @brief The baseline: a std::deque behind a mutex. */
+    class MutexDequeQueue
+    {
+    public:
+        bool try_push(const std::uint64_t value)
+        {
+            std::lock_guard lock(mutex_);
+            queue_.push_back(value);
+            return true;
+        }
+
+        bool try_pop(std::uint64_t& out)
+        {
+            std::lock_guard lock(mutex_);
+            if (queue_.empty())
+            {
+                return false;
+            }
+            out = queue_.front();
+            queue_.pop_front();
+            return true;
+        }
+
+    private:
+        std::mutex mutex_;
+        std::deque<std::uint64_t> queue_;
+    };
+
+    /** @brief The same mutex-protected deque used as a LIFO. */
+    class MutexDequeStack
+    {
+    public:
+        bool try_push(const std::uint64_t value)
+        {
+            std::lock_guard lock(mutex_);
+            stack_.push_back(value);
+            return true;
+        }
+
+        bool try_pop(std::uint64_t& out)
+        {
+            std::lock_guard lock(mutex_);
+            if (stack_.empty())
+            {
+                return false;
+            }
+            out = stack_.back();
+            stack_.pop_back();
+            return true;
+        }
+
+    private:
+        std::mutex mutex_;
+        std::deque<std::uint64_t> stack_;
+    };
+
+    /** @brief range(0) producers hand messages to as many consumers through @p container. */
+    template <typename Container>
+    void exchange(benchmark::State& state, Container& container)
+    {
+        const auto pairs = static_cast<std::size_t>(state.range(0));
+        const std::uint64_t total = messages_per_producer * pairs;
+
+        for (auto _ : state)
+        {
+            std::atomic<std::uint64_t> received{0};
+            std::vector<std::thread> threads;
+            threads.reserve(pairs * 2);
+
+            for (std::size_t i = 0; i < pairs; ++i)
+            {
+                threads.emplace_back([&container]
+                {
+                    for (std::uint64_t m = 0; m < messages_per_producer; ++m)
+                    {
+                        while (!container.try_push(m))
+                        {
+                            std::this_thread::yield();
+                        }
+                    }
+                });
+                threads.emplace_back([&container, &received, total]
+                {
+                    std::uint64_t value = 0;
+                    while (received.load(std::memory_order_relaxed) < total)
+                    {
+                        if (container.try_pop(value))
+                        {
+                            benchmark::DoNotOptimize(value);
+                            received.fetch_add(1, std::memory_order_relaxed);
+                        }
+                        else
+                        {
+                            std::this_thread::yield();
+                        }
+                    }
+                });
+            }
+
+            for (auto& thread : threads)
+            {
+                thread.join();
+            }
+        }
+
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * total));
+    }
+}
+
+static void BM_LockFreeQueue_Exchange(benchmark::State& state)
+{
+    LockFreeQueue<std::uint64_t> queue(1024);
+    exchange(state, queue);
+}
+
+BENCHMARK(BM_LockFreeQueue_Exchange)->Arg(1)->Arg(2)->Arg(4)->UseRealTime();
+
+static void BM_MutexDeque_Queue_Exchange(benchmark::State& state)
+{
+    MutexDequeQueue queue;
+    exchange(state, queue);
+}
+
+BENCHMARK(BM_MutexDeque_Queue_Exchange)->Arg(1)->Arg(2)->Arg(4)->UseRealTime();
+
+static void BM_LockFreeStack_Exchange(benchmark::State& state)
+{
+    LockFreeStack<std::uint64_t> stack(1024);
+    exchange(state, stack);
+}
+
+BENCHMARK(BM_LockFreeStack_Exchange)->Arg(1)->Arg(2)->Arg(4)->UseRealTime();
+
+static void BM_MutexDeque_Stack_Exchange(benchmark::State& state)
+{
+    MutexDequeStack stack;
+    exchange(state, stack);
+}
+
+BENCHMARK(BM_MutexDeque_Stack_Exchange)->Arg(1)->Arg(2)->Arg(4)->UseRealTime();
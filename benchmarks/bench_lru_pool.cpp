@@ -0,0 +1,115 @@
+#include <benchmark/benchmark.h>
+#include "lru_pool.h"
+#include <cstdint>
+#include <list>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+using namespace fast_alloc;
+
+namespace
+{
+    constexpr std::size_t cache_capacity = 4096;
+    constexpr std::size_t key_range = cache_capacity * 2; // Roughly half the lookups miss
+    constexpr std::size_t key_count = 1 << 16;
+
+    struct Payload
+    {
+        std::uint64_t data[4];
+    };
+
+    /** @brief The usual hash map + recency list LRU, allocating a node per insert. */
+    class StdLruCache
+    {
+    public:
+        explicit StdLruCache(const std::size_t capacity)
+            : capacity_(capacity)
+        {
+            index_.reserve(capacity);
+        }
+
+        Payload* find(const std::uint64_t key)
+        {
+            const auto it = index_.find(key);
+            if (it == index_.end())
+            {
+                return nullptr;
+            }
+            order_.splice(order_.begin(), order_, it->second);
+            return &it->second->second;
+        }
+
+        void insert_or_assign(const std::uint64_t key, const Payload& value)
+        {
+            if (Payload* existing = find(key))
+            {
+                *existing = value;
+                return;
+            }
+            if (order_.size() == capacity_)
+            {
+                index_.erase(order_.back().first);
+                order_.pop_back();
+            }
+            order_.emplace_front(key, value);
+            index_.emplace(key, order_.begin());
+        }
+
+    private:
+        std::size_t capacity_;
+        std::list<std::pair<std::uint64_t, Payload>> order_;
+        std::unordered_map<std::uint64_t, std::list<std::pair<std::uint64_t, Payload>>::iterator> index_;
+    };
+
+    std::vector<std::uint64_t> make_keys()
+    {
+        std::mt19937_64 rng(42);
+        std::uniform_int_distribution<std::uint64_t> dist(0, key_range - 1);
+        std::vector<std::uint64_t> keys(key_count);
+        for (auto& key : keys)
+        {
+            key = dist(rng);
+        }
+        return keys;
+    }
+
+    /** @brief Get-or-insert over a random key stream; identical work for both caches. */
+    template <typename Cache>
+    void lookup_or_fill(benchmark::State& state, Cache& cache)
+    {
+        const std::vector<std::uint64_t> keys = make_keys();
+        std::size_t i = 0;
+
+        for (auto _ : state)
+        {
+            const std::uint64_t key = keys[i++ & (key_count - 1)];
+            if (Payload* hit = cache.find(key))
+            {
+                benchmark::DoNotOptimize(hit);
+            }
+            else
+            {
+                cache.insert_or_assign(key, Payload{{key, key, key, key}});
+            }
+        }
+
+        state.SetItemsProcessed(state.iterations());
+    }
+}
+
+static void BM_LruPool_LookupOrFill(benchmark::State& state)
+{
+    LruPool<std::uint64_t, Payload> cache(cache_capacity);
+    lookup_or_fill(state, cache);
+}
+
+BENCHMARK(BM_LruPool_LookupOrFill);
+
+static void BM_StdLru_LookupOrFill(benchmark::State& state)
+{
+    StdLruCache cache(cache_capacity);
+    lookup_or_fill(state, cache);
+}
+
+BENCHMARK(BM_StdLru_LookupOrFill);
@@ -0,0 +1,79 @@
+#include <benchmark/benchmark.h>
+#include "memory_budget.h"
+#include "pool_allocator.h"
+
+using namespace fast_alloc;
+
+static void BM_PoolAllocator_Unbudgeted(benchmark::State& state)
+{
+    PoolAllocator pool(64, 1000);
+
+    for (auto _ : state)
+    {
+        void* ptr = pool.allocate();
+        benchmark::DoNotOptimize(ptr);
+        pool.deallocate(ptr);
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+
+BENCHMARK(BM_PoolAllocator_Unbudgeted);
+
+static void BM_PoolAllocator_Budgeted(benchmark::State& state)
+{
+    MemoryBudget process("process");
+    MemoryBudget subsystem("subsystem", &process);
+    MemoryBudget component("component", &subsystem);
+
+    PoolAllocator pool(64, 1000);
+    BudgetedAllocator charged(pool, component);
+
+    for (auto _ : state)
+    {
+        void* ptr = charged.allocate(64);
+        benchmark::DoNotOptimize(ptr);
+        charged.deallocate(ptr, 64);
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+
+BENCHMARK(BM_PoolAllocator_Budgeted);
+
+static void BM_PoolAllocator_BudgetedHardLimit(benchmark::State& state)
+{
+    MemoryBudget process("process", nullptr, MemoryBudget::unlimited, 1024 * 1024);
+    MemoryBudget subsystem("subsystem", &process, MemoryBudget::unlimited, 512 * 1024);
+    MemoryBudget component("component", &subsystem);
+
+    PoolAllocator pool(64, 1000);
+    BudgetedAllocator charged(pool, component);
+
+    for (auto _ : state)
+    {
+        void* ptr = charged.allocate(64);
+        benchmark::DoNotOptimize(ptr);
+        charged.deallocate(ptr, 64);
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+
+BENCHMARK(BM_PoolAllocator_BudgetedHardLimit);
+
+static void BM_MemoryBudget_ChargeMultiThread(benchmark::State& state)
+{
+    static MemoryBudget process("process");
+    static MemoryBudget shared("shared", &process);
+
+    for (auto _ : state)
+    {
+        shared.charge(64);
+        shared.release(64);
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+
+BENCHMARK(BM_MemoryBudget_ChargeMultiThread)->Threads(1)->Threads(4);
@@ -0,0 +1,87 @@
+#include <benchmark/benchmark.h>
+#include "mirrored_ring_buffer.h"
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+using namespace fast_alloc;
+
+namespace
+{
+    constexpr std::size_t ring_capacity = 1 << 12; // Small enough that frames wrap often
+
+    std::size_t frame_size(const std::size_t i)
+    {
+        return 64 + (i * 97) % 1400; // Network-frame-like sizes
+    }
+
+    /** @brief Sum a frame in place, as a parser would touch it. */
+    std::uint64_t parse(const unsigned char* frame, const std::size_t size)
+    {
+        std::uint64_t sum = 0;
+        for (std::size_t i = 0; i < size; i += 64)
+        {
+            sum += frame[i];
+        }
+        return sum;
+    }
+}
+
+// Write and parse frames through the mirrored ring: never split, never copied
+static void BM_MirroredRing_Stream(benchmark::State& state)
+{
+    MirroredRingBuffer ring(ring_capacity);
+    std::size_t i = 0;
+
+    for (auto _ : state)
+    {
+        const std::size_t size = frame_size(i++);
+        void* space = ring.reserve(size);
+        std::memset(space, 0x5A, size);
+        ring.commit(size);
+
+        std::size_t readable = 0;
+        const auto* frame = static_cast<const unsigned char*>(ring.peek(&readable, size));
+        benchmark::DoNotOptimize(parse(frame, size));
+        ring.consume(size);
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(BM_MirroredRing_Stream);
+
+// The same stream through a plain ring: frames crossing the end are written in two parts and
+// reassembled into a scratch buffer before parsing
+static void BM_PlainRing_Stream(benchmark::State& state)
+{
+    std::vector<unsigned char> ring(ring_capacity);
+    std::vector<unsigned char> scratch(2048);
+    std::uint64_t head = 0;
+    std::size_t i = 0;
+
+    for (auto _ : state)
+    {
+        const std::size_t size = frame_size(i++);
+        const std::size_t offset = head & (ring_capacity - 1);
+        const std::size_t first = std::min(size, ring_capacity - offset);
+
+        std::memset(ring.data() + offset, 0x5A, first);
+        std::memset(ring.data(), 0x5A, size - first);
+
+        const unsigned char* frame = ring.data() + offset;
+        if (first < size)
+        {
+            std::memcpy(scratch.data(), ring.data() + offset, first);
+            std::memcpy(scratch.data() + first, ring.data(), size - first);
+            frame = scratch.data();
+        }
+        benchmark::DoNotOptimize(parse(frame, size));
+        head += size;
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(BM_PlainRing_Stream);
@@ -1,5 +1,7 @@
 #include <benchmark/benchmark.h>
 #include "pool_allocator.h"
+#include <algorithm>
+#include <random>
 #include <vector>
 
 using namespace fast_alloc;
@@ -22,6 +24,24 @@ static void BM_PoolAllocator_Allocate(benchmark::State& state)
 
 BENCHMARK(BM_PoolAllocator_Allocate);
 
+static void BM_PoolAllocator_OutOfBand_Allocate(benchmark::State& state)
+{
+    constexpr std::size_t block_size = 64;
+    constexpr std::size_t block_count = 10000;
+    PoolAllocator pool(block_size, block_count, alignof(std::max_align_t), FreeSlotTracking::OutOfBand);
+
+    for (auto _ : state)
+    {
+        void* ptr = pool.allocate();
+        benchmark::DoNotOptimize(ptr);
+        pool.deallocate(ptr);
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(BM_PoolAllocator_OutOfBand_Allocate);
+
 static void BM_NewDelete_Allocate(benchmark::State& state)
 {
     for (auto _ : state)
@@ -94,3 +114,50 @@ static void BM_NewDelete_BulkAllocate(benchmark::State& state)
 }
 
 BENCHMARK(BM_NewDelete_BulkAllocate)->Arg(100)->Arg(1000)->Arg(5000);
+
+static void BM_PoolAllocator_FragmentedBatch(benchmark::State& state)
+{
+    constexpr std::size_t block_size = 64;
+    constexpr std::size_t block_count = 1 << 16;
+    const bool optimise = state.range(0) != 0;
+
+    PoolAllocator pool(block_size, block_count);
+    std::vector<void*> ptrs(block_count);
+    for (auto& ptr : ptrs)
+    {
+        ptr = pool.allocate();
+    }
+
+    // Simulate hours of random frees
+    std::shuffle(ptrs.begin(), ptrs.end(), std::mt19937{42});
+    for (void* ptr : ptrs)
+    {
+        pool.deallocate(ptr);
+    }
+
+    if (optimise)
+    {
+        pool.optimize_locality();
+    }
+
+    for (auto _ : state)
+    {
+        for (auto& ptr : ptrs)
+        {
+            ptr = pool.allocate();
+            *static_cast<std::size_t*>(ptr) = 1;
+        }
+
+        benchmark::ClobberMemory();
+
+        // Free in reverse so the next batch sees the same order
+        for (auto it = ptrs.rbegin(); it != ptrs.rend(); ++it)
+        {
+            pool.deallocate(*it);
+        }
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * block_count));
+}
+
+BENCHMARK(BM_PoolAllocator_FragmentedBatch)->Arg(0)->Arg(1);
@@ -0,0 +1,55 @@
+#include <benchmark/benchmark.h>
+#include "pool_allocator.h"
+#include "reclaim_registry.h"
+#include <vector>
+
+using namespace fast_alloc;
+
+// Exhausted pool backed by a cache that gives one block back per reclaim
+static void BM_PoolAllocator_ReclaimOnExhaustion(benchmark::State& state)
+{
+    constexpr std::size_t block_count = 1024;
+    PoolAllocator pool(64, block_count);
+    ReclaimRegistry registry;
+    pool.set_reclaim_registry(&registry);
+
+    std::vector<void*> cache;
+    while (void* ptr = pool.allocate())
+    {
+        cache.push_back(ptr);
+    }
+
+    registry.add([&](std::size_t)
+    {
+        pool.deallocate(cache.back());
+        cache.pop_back();
+        return pool.block_size();
+    });
+
+    for (auto _ : state)
+    {
+        void* ptr = pool.allocate(); // Always exhausted: reclaims one cache entry
+        benchmark::DoNotOptimize(ptr);
+        cache.push_back(ptr);        // Reinsert into the cache
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+
+BENCHMARK(BM_PoolAllocator_ReclaimOnExhaustion);
+
+static void BM_ReclaimRegistry_Poll(benchmark::State& state)
+{
+    ReclaimRegistry registry;
+    registry.set_rss_threshold(SIZE_MAX / 2); // Never crossed: measures the check itself
+    registry.set_pressure_threshold(99.0, 1024);
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(registry.poll());
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+
+BENCHMARK(BM_ReclaimRegistry_Poll);
@@ -0,0 +1,134 @@
+#include <benchmark/benchmark.h>
+#include "spsc_ring_allocator.h"
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace fast_alloc;
+
+namespace
+{
+    constexpr std::size_t record_count = 100000;
+
+    std::size_t record_size(const std::size_t i)
+    {
+        return 32 + (i * 41) % 200; // 32-231 byte log lines
+    }
+}
+
+// Reserve, write, commit, read, release on one thread: the ring's own cost
+static void BM_SpscRing_RoundTrip(benchmark::State& state)
+{
+    SpscRingAllocator ring(1 << 16);
+    std::size_t i = 0;
+
+    for (auto _ : state)
+    {
+        const std::size_t size = record_size(i++);
+        void* record = ring.reserve(size);
+        std::memset(record, 0x5A, size);
+        ring.commit();
+
+        std::size_t received = 0;
+        benchmark::DoNotOptimize(ring.front(&received));
+        ring.release();
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(BM_SpscRing_RoundTrip);
+
+// Producer thread to consumer thread through the ring: no allocation, no copy
+static void BM_SpscRing_Transfer(benchmark::State& state)
+{
+    SpscRingAllocator ring(1 << 20);
+
+    for (auto _ : state)
+    {
+        std::thread producer([&ring]
+        {
+            for (std::size_t i = 0; i < record_count; ++i)
+            {
+                const std::size_t size = record_size(i);
+                void* record;
+                while (!(record = ring.reserve(size)))
+                {
+                    std::this_thread::yield();
+                }
+                std::memset(record, 0x5A, size);
+                ring.commit();
+            }
+        });
+
+        for (std::size_t received = 0; received < record_count;)
+        {
+            std::size_t size = 0;
+            if (const void* record = ring.front(&size))
+            {
+                benchmark::DoNotOptimize(record);
+                ring.release();
+                ++received;
+            }
+            else
+            {
+                std::this_thread::yield();
+            }
+        }
+        producer.join();
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * record_count));
+}
+
+BENCHMARK(BM_SpscRing_Transfer)->UseRealTime();
+
+// The usual alternative: a heap-allocated buffer per record through a mutex-protected deque
+static void BM_MutexDeque_Transfer(benchmark::State& state)
+{
+    std::mutex mutex;
+    std::deque<std::vector<char>> queue;
+
+    for (auto _ : state)
+    {
+        std::thread producer([&]
+        {
+            for (std::size_t i = 0; i < record_count; ++i)
+            {
+                std::vector<char> record(record_size(i));
+                std::memset(record.data(), 0x5A, record.size());
+
+                std::lock_guard lock(mutex);
+                queue.push_back(std::move(record));
+            }
+        });
+
+        for (std::size_t received = 0; received < record_count;)
+        {
+            std::vector<char> record;
+            {
+                std::lock_guard lock(mutex);
+                if (!queue.empty())
+                {
+                    record = std::move(queue.front());
+                    queue.pop_front();
+                }
+            }
+
+            if (record.empty())
+            {
+                std::this_thread::yield();
+                continue;
+            }
+            benchmark::DoNotOptimize(record.data());
+            ++received;
+        }
+        producer.join();
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * record_count));
+}
+
+BENCHMARK(BM_MutexDeque_Transfer)->UseRealTime();
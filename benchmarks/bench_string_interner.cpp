@@ -0,0 +1,74 @@
+#include <benchmark/benchmark.h>
+#include "string_interner.h"
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+using namespace fast_alloc;
+
+namespace
+{
+    std::vector<std::string> make_labels(const std::size_t distinct)
+    {
+        std::vector<std::string> labels;
+        labels.reserve(distinct);
+        for (std::size_t i = 0; i < distinct; ++i)
+        {
+            labels.push_back("http.server.request.duration{route=/api/v1/item/" + std::to_string(i) + "}");
+        }
+        return labels;
+    }
+}
+
+static void BM_StringInterner_InternRepeated(benchmark::State& state)
+{
+    const auto labels = make_labels(static_cast<std::size_t>(state.range(0)));
+    StringInterner interner;
+    std::size_t i = 0;
+
+    for (auto _ : state)
+    {
+        StringId id = interner.intern(labels[i]);
+        benchmark::DoNotOptimize(id);
+        i = (i + 1) % labels.size();
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+
+BENCHMARK(BM_StringInterner_InternRepeated)->Arg(100)->Arg(10000);
+
+static void BM_StdString_CopyRepeated(benchmark::State& state)
+{
+    const auto labels = make_labels(static_cast<std::size_t>(state.range(0)));
+    std::size_t i = 0;
+
+    for (auto _ : state)
+    {
+        std::string copy(labels[i]);
+        benchmark::DoNotOptimize(copy.data());
+        i = (i + 1) % labels.size();
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+
+BENCHMARK(BM_StdString_CopyRepeated)->Arg(100)->Arg(10000);
+
+static void BM_UnorderedSet_InternRepeated(benchmark::State& state)
+{
+    const auto labels = make_labels(static_cast<std::size_t>(state.range(0)));
+    std::unordered_set<std::string> set;
+    std::size_t i = 0;
+
+    for (auto _ : state)
+    {
+        auto it = set.emplace(labels[i]).first;
+        benchmark::DoNotOptimize(&*it);
+        i = (i + 1) % labels.size();
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+
+BENCHMARK(BM_UnorderedSet_InternRepeated)->Arg(100)->Arg(10000);
@@ -185,3 +185,53 @@ BENCHMARK(BM_ThreadSafePoolAllocator_BulkOperations)
     ->Arg(500)
     ->Arg(1000)
     ->UseRealTime();
+
+static void BM_ThreadSafePoolAllocator_FalseSharing(benchmark::State& state)
+{
+    constexpr std::size_t block_size = 16;
+    constexpr std::size_t num_threads = 4;
+    const auto alignment = static_cast<std::size_t>(state.range(0));
+    ThreadSafePoolAllocator pool(block_size, num_threads, alignment);
+
+    std::vector<void*> blocks;
+    for (std::size_t i = 0; i < num_threads; ++i)
+    {
+        blocks.push_back(pool.allocate());
+    }
+
+    for (auto _ : state)
+    {
+        std::vector<std::thread> threads;
+        threads.reserve(num_threads);
+
+        for (std::size_t i = 0; i < num_threads; ++i)
+        {
+            threads.emplace_back([block = blocks[i]]()
+            {
+                auto* counter = static_cast<volatile std::size_t*>(block);
+                for (int j = 0; j < 10000; ++j)
+                {
+                    *counter = *counter + 1;
+                }
+            });
+        }
+
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+    }
+
+    for (void* block : blocks)
+    {
+        pool.deallocate(block);
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * num_threads * 10000));
+}
+
+BENCHMARK(BM_ThreadSafePoolAllocator_FalseSharing)
+    ->Arg(16)
+    ->Arg(64)
+    ->Arg(128)
+    ->UseRealTime();
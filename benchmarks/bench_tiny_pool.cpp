@@ -0,0 +1,85 @@
+#include <benchmark/benchmark.h>
+#include "tiny_pool_allocator.h"
+#include "pool_allocator.h"
+#include <vector>
+
+using namespace fast_alloc;
+
+static void BM_TinyPoolAllocator_Allocate(benchmark::State& state)
+{
+    constexpr std::size_t block_size = 4;
+    constexpr std::size_t block_count = 10000;
+    TinyPoolAllocator pool(block_size, block_count);
+
+    for (auto _ : state)
+    {
+        void* ptr = pool.allocate();
+        benchmark::DoNotOptimize(ptr);
+        pool.deallocate(ptr);
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+
+BENCHMARK(BM_TinyPoolAllocator_Allocate);
+
+static void BM_TinyPoolAllocator_BulkAllocate(benchmark::State& state)
+{
+    const auto num_allocs = static_cast<std::size_t>(state.range(0));
+
+    for (auto _ : state)
+    {
+        constexpr std::size_t block_size = 4;
+        TinyPoolAllocator pool(block_size, num_allocs);
+        std::vector<void*> ptrs;
+        ptrs.reserve(num_allocs);
+
+        for (std::size_t i = 0; i < num_allocs; ++i)
+        {
+            ptrs.push_back(pool.allocate());
+        }
+
+        benchmark::DoNotOptimize(ptrs.data());
+
+        for (void* ptr : ptrs)
+        {
+            pool.deallocate(ptr);
+        }
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * num_allocs));
+    state.counters["bytes_per_block"] = 4.0 + 1.0 / 8.0;
+}
+
+BENCHMARK(BM_TinyPoolAllocator_BulkAllocate)->Arg(1000)->Arg(100000);
+
+static void BM_PoolAllocator_TinyRecords(benchmark::State& state)
+{
+    const auto num_allocs = static_cast<std::size_t>(state.range(0));
+
+    for (auto _ : state)
+    {
+        // 4-byte records padded out to a pointer-sized, max-aligned block
+        PoolAllocator pool(sizeof(void*), num_allocs);
+        std::vector<void*> ptrs;
+        ptrs.reserve(num_allocs);
+
+        for (std::size_t i = 0; i < num_allocs; ++i)
+        {
+            ptrs.push_back(pool.allocate());
+        }
+
+        benchmark::DoNotOptimize(ptrs.data());
+
+        for (void* ptr : ptrs)
+        {
+            pool.deallocate(ptr);
+        }
+
+        state.counters["bytes_per_block"] = static_cast<double>(pool.block_stride());
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * num_allocs));
+}
+
+BENCHMARK(BM_PoolAllocator_TinyRecords)->Arg(1000)->Arg(100000);
@@ -0,0 +1,134 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+
+namespace fast_alloc
+{
+    /**
+     * @brief Allocator handing out memory of any size: allocate(size, alignment).
+     *
+     * Satisfied by StackAllocator, BinnedArenaAllocator, FreeListAllocator and BudgetedAllocator.
+     * Memory is returned with deallocate(ptr, size, alignment), deallocate(ptr), or - for arenas
+     * without per-allocation free - by reset().
+     */
+    template <typename A>
+    concept SizedAllocator = requires(A& allocator, std::size_t size, std::size_t alignment)
+    {
+        { allocator.allocate(size, alignment) } -> std::same_as<void*>;
+    };
+
+    /**
+     * @brief Allocator handing out fixed-size blocks: allocate() + deallocate(ptr) + block_size().
+     *
+     * Satisfied by every BasicPoolAllocator configuration and TinyPoolAllocator.
+     */
+    template <typename A>
+    concept BlockAllocator = requires(A& allocator, const A& view, void* ptr)
+    {
+        { allocator.allocate() } -> std::same_as<void*>;
+        allocator.deallocate(ptr);
+        { view.block_size() } -> std::convertible_to<std::size_t>;
+    };
+
+    /**
+     * @brief Any fast-alloc allocator.
+     *
+     * Generic code constrained on Allocator calls fast_alloc::allocate() and
+     * fast_alloc::deallocate(), which pick the right member calls at compile time - no indirect
+     * call, and fully inlinable. Where the allocator type must be erased (stored in a
+     * non-template class, passed across a library boundary), use AllocatorHandle, which costs
+     * one indirect call per operation.
+     *
+     * Example:
+     * @code
+     * template <Allocator A>
+     * Packet* make_packet(A& allocator)
+     * {
+     *     return new (fast_alloc::allocate(allocator, sizeof(Packet), alignof(Packet))) Packet{};
+     * }
+     * @endcode
+     */
+    template <typename A>
+    concept Allocator = SizedAllocator<A> || BlockAllocator<A>;
+
+    /**
+     * @brief Get the alignment every block of @p pool is guaranteed to have.
+     * @note Pools without an alignment() member (TinyPoolAllocator) pack blocks at block_size()
+     *       stride, so only the largest power of 2 dividing block_size() is guaranteed.
+     */
+    template <BlockAllocator A>
+    [[nodiscard]] std::size_t block_alignment(const A& pool) noexcept
+    {
+        if constexpr (requires { pool.alignment(); })
+        {
+            return pool.alignment();
+        }
+        else
+        {
+            const std::size_t size = pool.block_size();
+            return std::min(std::size_t{1} << std::countr_zero(size), alignof(std::max_align_t));
+        }
+    }
+
+    /**
+     * @brief Allocate @p size bytes aligned to @p alignment from @p allocator.
+     *
+     * @return Pointer to allocated memory, or nullptr if the allocator cannot satisfy the request.
+     *         Pools refuse requests larger or more aligned than their blocks.
+     */
+    template <Allocator A>
+    [[nodiscard]] void* allocate(A& allocator, const std::size_t size,
+                                 const std::size_t alignment = alignof(std::max_align_t))
+    {
+        if constexpr (SizedAllocator<A>)
+        {
+            return allocator.allocate(size, alignment);
+        }
+        else
+        {
+            // A pool can only hand out one block of its own size and alignment
+            if (size > allocator.block_size() || alignment > block_alignment(allocator))
+            {
+                return nullptr;
+            }
+            return allocator.allocate();
+        }
+    }
+
+    /**
+     * @brief Return memory from fast_alloc::allocate() to @p allocator.
+     *
+     * @p size and @p alignment must match the allocation. nullptr is safely ignored.
+     * A no-op for arenas; their memory is reclaimed by reset().
+     */
+    template <Allocator A>
+    void deallocate(A& allocator, void* ptr, const std::size_t size,
+                    const std::size_t alignment = alignof(std::max_align_t))
+    {
+        if (!ptr)
+        {
+            return;
+        }
+
+        if constexpr (requires { allocator.deallocate(ptr, size, alignment); })
+        {
+            allocator.deallocate(ptr, size, alignment);
+        }
+        else if constexpr (requires { allocator.deallocate(ptr); })
+        {
+            (void)size;
+            (void)alignment;
+            allocator.deallocate(ptr);
+        }
+        else
+        {
+            // Arena: memory is reclaimed by reset()
+            (void)allocator;
+            (void)size;
+            (void)alignment;
+        }
+    }
+} // namespace fast_alloc
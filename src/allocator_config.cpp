@@ -0,0 +1,77 @@
+#include "allocator_config.h"
+
+#include <cassert>
+#include <cstdio>
+#include <cstdlib>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#include <malloc.h>
+#else
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace fast_alloc
+{
+    void* HeapBackend::allocate(const std::size_t size, const std::size_t alignment) noexcept
+    {
+        // aligned_alloc requires the size to be a multiple of the alignment
+        const std::size_t rounded = (size + alignment - 1) & ~(alignment - 1);
+#ifdef _WIN32
+        return _aligned_malloc(rounded, alignment);
+#else
+        return std::aligned_alloc(alignment, rounded);
+#endif
+    }
+
+    void HeapBackend::deallocate(void* ptr, const std::size_t size) noexcept
+    {
+        (void)size;
+#ifdef _WIN32
+        _aligned_free(ptr);
+#else
+        std::free(ptr);
+#endif
+    }
+
+    void* PageBackend::allocate(const std::size_t size, const std::size_t alignment) noexcept
+    {
+#ifdef _WIN32
+        SYSTEM_INFO info;
+        GetSystemInfo(&info);
+        assert(alignment <= info.dwPageSize && "Page backend alignment must not exceed the page size");
+        (void)alignment;
+
+        return VirtualAlloc(nullptr, size, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+#else
+        assert(alignment <= static_cast<std::size_t>(sysconf(_SC_PAGESIZE))
+            && "Page backend alignment must not exceed the page size");
+        (void)alignment;
+
+        void* memory = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        return memory == MAP_FAILED ? nullptr : memory;
+#endif
+    }
+
+    void PageBackend::deallocate(void* ptr, const std::size_t size) noexcept
+    {
+#ifdef _WIN32
+        (void)size;
+        VirtualFree(ptr, 0, MEM_RELEASE);
+#else
+        munmap(ptr, size);
+#endif
+    }
+
+    namespace detail
+    {
+        void validation_failure(const char* message) noexcept
+        {
+            std::fprintf(stderr, "fast_alloc: %s\n", message);
+            std::abort();
+        }
+    } // namespace detail
+} // namespace fast_alloc
@@ -0,0 +1,121 @@
+#pragma once
+
+#include <cstddef>
+
+namespace fast_alloc
+{
+    /**
+     * @brief Memory source that takes an allocator's backing block from the C heap
+     * (aligned_alloc / _aligned_malloc).
+     */
+    struct HeapBackend
+    {
+        /** @brief Allocate @p size bytes aligned to @p alignment; nullptr on failure. */
+        static void* allocate(std::size_t size, std::size_t alignment) noexcept;
+
+        /** @brief Free memory from allocate(). */
+        static void deallocate(void* ptr, std::size_t size) noexcept;
+    };
+
+    /**
+     * @brief Memory source that maps an allocator's backing block directly from the OS
+     * (mmap / VirtualAlloc).
+     *
+     * Memory arrives zero-filled and page-aligned and goes straight back to the OS when the
+     * allocator is destroyed, instead of lingering in the C heap.
+     */
+    struct PageBackend
+    {
+        /** @brief Map @p size bytes (rounded up to whole pages); alignment must not exceed the page size. */
+        static void* allocate(std::size_t size, std::size_t alignment) noexcept;
+
+        /** @brief Unmap memory from allocate(). */
+        static void deallocate(void* ptr, std::size_t size) noexcept;
+    };
+
+    /** @brief True unless NDEBUG is defined; the default for validation features. */
+#ifdef NDEBUG
+    inline constexpr bool debug_build = false;
+#else
+    inline constexpr bool debug_build = true;
+#endif
+
+    /**
+     * @brief Compile-time feature selection for BasicPoolAllocator.
+     *
+     * Every member is a constant, and a disabled feature is removed with if constexpr - no
+     * branch, no counter update and no data member is left behind. Derive from a config and
+     * shadow the members to change:
+     *
+     * @code
+     * struct StagingPoolConfig : PoolConfig
+     * {
+     *     static constexpr bool validate = true;           // Even in release builds
+     *     static constexpr bool detect_double_free = true;
+     * };
+     * using StagingPool = BasicPoolAllocator<StagingPoolConfig>;
+     * @endcode
+     */
+    struct PoolConfig
+    {
+        /// Serialise every operation on a std::mutex (otherwise no lock at all)
+        static constexpr bool thread_safe = false;
+
+        /// Count allocated blocks; needed by allocated() and makes is_full() O(1) without reading the free list
+        static constexpr bool statistics = true;
+
+        /// Check on deallocate() that a pointer lies inside the pool on a block boundary
+        static constexpr bool validate = debug_build;
+
+        /// Check the pool's free-block bitmap to catch double frees; implies the range checks
+        static constexpr bool detect_double_free = false;
+
+        /// Default block alignment
+        static constexpr std::size_t alignment = alignof(std::max_align_t);
+
+        /// Where the block memory comes from
+        using Backend = HeapBackend;
+    };
+
+    /** @brief PoolConfig with a mutex; the configuration of ThreadSafePoolAllocator. */
+    struct ThreadSafePoolConfig : PoolConfig
+    {
+        static constexpr bool thread_safe = true;
+    };
+
+    /** @brief Release configuration: no counters and no checks, in any build. */
+    struct LeanPoolConfig : PoolConfig
+    {
+        static constexpr bool statistics = false;
+        static constexpr bool validate = false;
+    };
+
+    /** @brief Staging configuration: every check, in any build. */
+    struct CheckedPoolConfig : PoolConfig
+    {
+        static constexpr bool validate = true;
+        static constexpr bool detect_double_free = true;
+    };
+
+    namespace detail
+    {
+        /**
+         * @brief Stand-in for a data member of type T that a config compiled out.
+         * Takes no space with [[no_unique_address]]; distinct per T, so several can share an address.
+         */
+        template <typename T>
+        struct Disabled
+        {
+        };
+
+        /** @brief Lock type of single-threaded configs. */
+        struct NullMutex
+        {
+            void lock() noexcept {}
+            void unlock() noexcept {}
+        };
+
+        /** @brief Report a failed validation check and abort. Unlike assert, active in every build. */
+        [[noreturn]] void validation_failure(const char* message) noexcept;
+    } // namespace detail
+} // namespace fast_alloc
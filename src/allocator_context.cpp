@@ -0,0 +1,24 @@
+#include "allocator_context.h"
+
+#include <new>
+
+namespace fast_alloc
+{
+    const AllocatorHandle& heap_allocator() noexcept
+    {
+        return detail::heap_handle;
+    }
+
+    namespace detail
+    {
+        void* heap_allocate(void*, const std::size_t size, const std::size_t alignment)
+        {
+            return ::operator new(size, std::align_val_t{alignment}, std::nothrow);
+        }
+
+        void heap_deallocate(void*, void* ptr, const std::size_t size, const std::size_t alignment)
+        {
+            ::operator delete(ptr, size, std::align_val_t{alignment});
+        }
+    } // namespace detail
+} // namespace fast_alloc
@@ -0,0 +1,241 @@
+#pragma once
+
+#include "allocator_concept.h"
+
+#include <cassert>
+#include <cstddef>
+#include <new>
+#include <type_traits>
+
+namespace fast_alloc
+{
+    /**
+     * @brief Type-erased reference to an allocator: an object pointer plus two function pointers.
+     *
+     * Built with AllocatorHandle::of() from any type satisfying the Allocator concept. Arenas
+     * without per-allocation free (StackAllocator) get a no-op deallocate; pools reject requests
+     * larger or more aligned than their blocks.
+     *
+     * Each call costs one indirect call. The function pointers are stored inline rather than
+     * behind a table pointer, so unlike a std::pmr::memory_resource virtual call there is no
+     * dependent load of a vtable first.
+     */
+    struct AllocatorHandle
+    {
+        void* self;
+        void* (*allocate_fn)(void* self, std::size_t size, std::size_t alignment);
+        void (*deallocate_fn)(void* self, void* ptr, std::size_t size, std::size_t alignment);
+
+        /**
+         * @brief Allocate through the referenced allocator.
+         * @return Pointer to allocated memory, or nullptr if the allocator cannot satisfy the request
+         */
+        void* allocate(const std::size_t size, const std::size_t alignment = alignof(std::max_align_t)) const
+        {
+            return allocate_fn(self, size, alignment);
+        }
+
+        /** @brief Return memory to the referenced allocator. nullptr is safely ignored. */
+        void deallocate(void* ptr, const std::size_t size,
+                        const std::size_t alignment = alignof(std::max_align_t)) const
+        {
+            if (ptr)
+            {
+                deallocate_fn(self, ptr, size, alignment);
+            }
+        }
+
+        /**
+         * @brief Build a handle referencing @p allocator (which must outlive the handle).
+         *
+         * Calls are forwarded through fast_alloc::allocate() and fast_alloc::deallocate(), so
+         * every shape covered by the Allocator concept is supported.
+         */
+        template <Allocator A>
+        static AllocatorHandle of(A& allocator) noexcept
+        {
+            return {&allocator, &allocate_thunk<A>, &deallocate_thunk<A>};
+        }
+
+        friend bool operator==(const AllocatorHandle&, const AllocatorHandle&) noexcept = default;
+
+    private:
+        template <Allocator A>
+        static void* allocate_thunk(void* self, const std::size_t size, const std::size_t alignment)
+        {
+            return fast_alloc::allocate(*static_cast<A*>(self), size, alignment);
+        }
+
+        template <Allocator A>
+        static void deallocate_thunk(void* self, void* ptr, const std::size_t size, const std::size_t alignment)
+        {
+            fast_alloc::deallocate(*static_cast<A*>(self), ptr, size, alignment);
+        }
+    };
+
+    /** @brief Handle to the global heap (aligned operator new/delete); the context of every thread by default. */
+    [[nodiscard]] const AllocatorHandle& heap_allocator() noexcept;
+
+    namespace detail
+    {
+        void* heap_allocate(void* self, std::size_t size, std::size_t alignment);
+        void heap_deallocate(void* self, void* ptr, std::size_t size, std::size_t alignment);
+
+        inline constexpr AllocatorHandle heap_handle{nullptr, &heap_allocate, &heap_deallocate};
+
+        /// Top of this thread's context stack; constant-initialised, so reading it is one TLS load
+        inline thread_local const AllocatorHandle* current_context = &heap_handle;
+    } // namespace detail
+
+    /**
+     * @brief Get the calling thread's current allocator.
+     *
+     * @return The handle of the innermost live AllocatorScope on this thread, or heap_allocator().
+     * @note Complexity: O(1) - one thread-local load
+     */
+    [[nodiscard]] inline const AllocatorHandle& current() noexcept
+    {
+        return *detail::current_context;
+    }
+
+    /** @brief Allocate from the calling thread's current allocator; nullptr if it is exhausted. */
+    [[nodiscard]] inline void* context_allocate(const std::size_t size,
+                                                const std::size_t alignment = alignof(std::max_align_t))
+    {
+        return current().allocate(size, alignment);
+    }
+
+    /**
+     * @brief Return memory to the calling thread's current allocator.
+     * @warning The context must be the one that was current when @p ptr was allocated.
+     */
+    inline void context_deallocate(void* ptr, const std::size_t size,
+                                   const std::size_t alignment = alignof(std::max_align_t))
+    {
+        current().deallocate(ptr, size, alignment);
+    }
+
+    /**
+     * @brief RAII push of an allocator onto the calling thread's context stack.
+     *
+     * While the scope is alive, current() - and everything built on it, such as ContextAllocator -
+     * resolves to @p allocator on this thread. The destructor pops it, restoring the previous
+     * context. Scopes nest and must be destroyed in reverse order of construction, which
+     * automatic (stack) storage guarantees.
+     *
+     * Example:
+     * @code
+     * StackAllocator request_arena(64 * 1024);
+     * {
+     *     AllocatorScope scope(request_arena);
+     *     handle_request(); // Library code allocating via current() lands in request_arena
+     * }
+     * request_arena.reset();
+     * @endcode
+     *
+     * @note Thread-safety: Each thread has its own stack; a scope only affects its own thread.
+     */
+    class AllocatorScope
+    {
+    public:
+        /** @brief Push @p allocator (which must outlive the scope). */
+        template <Allocator A>
+            requires (!std::is_same_v<std::remove_cv_t<A>, AllocatorHandle>)
+        explicit AllocatorScope(A& allocator) noexcept
+            : AllocatorScope(AllocatorHandle::of(allocator))
+        {
+        }
+
+        /** @brief Push an existing handle. */
+        explicit AllocatorScope(const AllocatorHandle& handle) noexcept
+            : handle_(handle)
+              , previous_(detail::current_context)
+        {
+            detail::current_context = &handle_;
+        }
+
+        ~AllocatorScope()
+        {
+            assert(detail::current_context == &handle_ && "AllocatorScope destroyed out of order");
+            detail::current_context = previous_;
+        }
+
+        // Pinned: the thread-local stack points at handle_
+        AllocatorScope(const AllocatorScope&) = delete;
+        AllocatorScope& operator=(const AllocatorScope&) = delete;
+
+    private:
+        AllocatorHandle handle_;
+        const AllocatorHandle* previous_;
+    };
+
+    /**
+     * @brief Standard-library allocator that binds to the context current at construction.
+     *
+     * A container default-constructs its allocator, so a container created inside an
+     * AllocatorScope allocates from that scope's allocator for its whole life - even if it later
+     * grows outside the scope. Copying a container re-binds the copy to the copier's context.
+     *
+     * Example:
+     * @code
+     * AllocatorScope scope(frame_arena);
+     * std::vector<int, ContextAllocator<int>> ids; // Grows inside frame_arena
+     * @endcode
+     *
+     * @warning Containers must not outlive the allocator their context referenced.
+     * @throws std::bad_alloc if the bound allocator returns nullptr
+     */
+    template <typename T>
+    class ContextAllocator
+    {
+    public:
+        using value_type = T;
+        using propagate_on_container_move_assignment = std::true_type;
+        using propagate_on_container_swap = std::true_type;
+
+        /** @brief Bind to the calling thread's current context. */
+        ContextAllocator() noexcept
+            : handle_(current())
+        {
+        }
+
+        template <typename U>
+        ContextAllocator(const ContextAllocator<U>& other) noexcept
+            : handle_(other.handle())
+        {
+        }
+
+        T* allocate(const std::size_t n)
+        {
+            void* ptr = handle_.allocate(n * sizeof(T), alignof(T));
+            if (!ptr)
+            {
+                throw std::bad_alloc();
+            }
+            return static_cast<T*>(ptr);
+        }
+
+        void deallocate(T* ptr, const std::size_t n) noexcept
+        {
+            handle_.deallocate(ptr, n * sizeof(T), alignof(T));
+        }
+
+        /** @brief Container copies bind to the context of the thread doing the copy. */
+        [[nodiscard]] ContextAllocator select_on_container_copy_construction() const noexcept
+        {
+            return ContextAllocator();
+        }
+
+        /** @brief Get the handle this allocator is bound to. */
+        [[nodiscard]] const AllocatorHandle& handle() const noexcept { return handle_; }
+
+        template <typename U>
+        bool operator==(const ContextAllocator<U>& other) const noexcept
+        {
+            return handle_ == other.handle();
+        }
+
+    private:
+        AllocatorHandle handle_; ///< By value, so containers may outlive the scope that bound them
+    };
+} // namespace fast_alloc
@@ -0,0 +1,190 @@
+#include "archetype_chunk_allocator.h"
+
+#include <cassert>
+#include <cstring>
+#include <utility>
+
+namespace fast_alloc
+{
+    ArchetypeChunkAllocator::ArchetypeChunkAllocator(const std::span<const ComponentLayout> components,
+                                                     const std::size_t max_chunks)
+        : entities_per_chunk_(0)
+          , size_(0)
+          , chunk_pool_(chunk_size, max_chunks, max_alignment(components))
+    {
+        assert(!components.empty() && "Archetype must have at least one component");
+
+        // Start from the unpadded estimate and shrink until the padded layout fits
+        std::size_t bytes_per_entity = 0;
+        for (const auto& component : components)
+        {
+            assert(component.size > 0 && "Component size must be greater than zero");
+            assert((component.alignment & (component.alignment - 1)) == 0 && "Alignment must be power of 2");
+            bytes_per_entity += component.size;
+        }
+
+        std::size_t count = chunk_size / bytes_per_entity;
+        while (count > 0 && layout_columns(components, count, columns_) > chunk_size)
+        {
+            --count;
+        }
+        assert(count > 0 && "One entity does not fit in a chunk");
+
+        entities_per_chunk_ = count;
+        layout_columns(components, count, columns_);
+    }
+
+    ArchetypeChunkAllocator::ArchetypeChunkAllocator(const std::initializer_list<ComponentLayout> components,
+                                                     const std::size_t max_chunks)
+        : ArchetypeChunkAllocator(std::span<const ComponentLayout>(components.begin(), components.size()), max_chunks)
+    {
+    }
+
+    ArchetypeChunkAllocator::ArchetypeChunkAllocator(ArchetypeChunkAllocator&& other) noexcept
+        : columns_(std::move(other.columns_))
+          , entities_per_chunk_(other.entities_per_chunk_)
+          , size_(other.size_)
+          , chunks_(std::move(other.chunks_))
+          , chunk_pool_(std::move(other.chunk_pool_))
+    {
+        other.size_ = 0;
+        other.chunks_.clear();
+    }
+
+    ArchetypeChunkAllocator& ArchetypeChunkAllocator::operator=(ArchetypeChunkAllocator&& other) noexcept
+    {
+        if (this != &other)
+        {
+            columns_ = std::move(other.columns_);
+            entities_per_chunk_ = other.entities_per_chunk_;
+            size_ = other.size_;
+            chunks_ = std::move(other.chunks_);
+            chunk_pool_ = std::move(other.chunk_pool_);
+
+            other.size_ = 0;
+            other.chunks_.clear();
+        }
+        return *this;
+    }
+
+    std::size_t ArchetypeChunkAllocator::create()
+    {
+        if (size_ == chunks_.size() * entities_per_chunk_)
+        {
+            void* chunk = chunk_pool_.allocate();
+            if (!chunk)
+            {
+                return npos; // Chunk pool exhausted
+            }
+            chunks_.push_back(chunk);
+        }
+
+        return size_++;
+    }
+
+    std::size_t ArchetypeChunkAllocator::destroy(const std::size_t row)
+    {
+        assert(row < size_ && "Row out of range");
+
+        const std::size_t last = size_ - 1;
+        std::size_t moved = npos;
+
+        if (row != last)
+        {
+            // Swap-remove: fill the hole with the last entity, column by column
+            for (std::size_t i = 0; i < columns_.size(); ++i)
+            {
+                std::memcpy(component(row, i), component(last, i), columns_[i].size);
+            }
+            moved = last;
+        }
+
+        --size_;
+
+        // Last chunk emptied - hand it back to the pool
+        if (size_ == (chunks_.size() - 1) * entities_per_chunk_)
+        {
+            chunk_pool_.deallocate(chunks_.back());
+            chunks_.pop_back();
+        }
+
+        return moved;
+    }
+
+    void ArchetypeChunkAllocator::clear() noexcept
+    {
+        for (void* chunk : chunks_)
+        {
+            chunk_pool_.deallocate(chunk);
+        }
+        chunks_.clear();
+        size_ = 0;
+    }
+
+    void* ArchetypeChunkAllocator::component(const std::size_t row, const std::size_t component) const noexcept
+    {
+        assert(row < size_ && "Row out of range");
+        assert(component < columns_.size() && "Component index out of range");
+
+        const std::size_t chunk = row / entities_per_chunk_;
+        const std::size_t index = row % entities_per_chunk_;
+        const Column& column = columns_[component];
+
+        return static_cast<std::byte*>(chunks_[chunk]) + column.offset + index * column.size;
+    }
+
+    void* ArchetypeChunkAllocator::column(const std::size_t chunk, const std::size_t component) const noexcept
+    {
+        assert(chunk < chunks_.size() && "Chunk index out of range");
+        assert(component < columns_.size() && "Component index out of range");
+
+        return static_cast<std::byte*>(chunks_[chunk]) + columns_[component].offset;
+    }
+
+    std::size_t ArchetypeChunkAllocator::chunk_entities(const std::size_t chunk) const noexcept
+    {
+        assert(chunk < chunks_.size() && "Chunk index out of range");
+
+        // Every chunk but the last is full
+        if (chunk + 1 < chunks_.size())
+        {
+            return entities_per_chunk_;
+        }
+        return size_ - chunk * entities_per_chunk_;
+    }
+
+    std::size_t ArchetypeChunkAllocator::layout_columns(const std::span<const ComponentLayout> components,
+                                                        const std::size_t count, std::vector<Column>& columns)
+    {
+        columns.clear();
+        std::size_t offset = 0;
+
+        for (const auto& component : components)
+        {
+            const std::size_t alignment = component.alignment > column_alignment ? component.alignment : column_alignment;
+            offset = (offset + alignment - 1) & ~(alignment - 1);
+            columns.push_back({offset, component.size});
+            offset += component.size * count;
+
+            if (offset > chunk_size)
+            {
+                return SIZE_MAX;
+            }
+        }
+
+        return offset;
+    }
+
+    std::size_t ArchetypeChunkAllocator::max_alignment(const std::span<const ComponentLayout> components) noexcept
+    {
+        std::size_t alignment = column_alignment;
+        for (const auto& component : components)
+        {
+            if (component.alignment > alignment)
+            {
+                alignment = component.alignment;
+            }
+        }
+        return alignment;
+    }
+} // namespace fast_alloc
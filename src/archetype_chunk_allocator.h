@@ -0,0 +1,171 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <span>
+#include <vector>
+
+#include "pool_allocator.h"
+
+namespace fast_alloc
+{
+    /**
+     * @brief Size and alignment of one component type in an archetype.
+     */
+    struct ComponentLayout
+    {
+        std::size_t size;      ///< sizeof(component)
+        std::size_t alignment; ///< alignof(component)
+    };
+
+    /** @brief Get the layout of component type @p T. */
+    template <typename T>
+    constexpr ComponentLayout component_layout() noexcept
+    {
+        return {sizeof(T), alignof(T)};
+    }
+
+    /**
+     * @brief Structure-of-arrays storage for entities sharing one component set (an archetype).
+     *
+     * Entities live in fixed 16 KiB chunks. Each chunk holds entities_per_chunk() entities, laid
+     * out as one cache-line aligned column per component, so iterating a component is a linear,
+     * SIMD-friendly scan. Entities are kept dense: every chunk but the last is full, and destroy()
+     * swap-removes by moving the last entity into the hole. Chunks come from a PoolAllocator and
+     * are returned to it when the last chunk empties.
+     *
+     * Entities are addressed by a dense row index; chunk = row / entities_per_chunk().
+     *
+     * Ideal for: ECS archetype tables, particle attributes, any batch of records processed
+     * one field at a time.
+     *
+     * @note Thread-safety: Not thread-safe.
+     * @note Memory overhead: Column padding inside each chunk, plus one pointer per chunk.
+     * @note Components are raw storage: create() does not construct them and destroy() does not
+     *       destroy them. They are relocated with memcpy, so they must be trivially relocatable.
+     */
+    class ArchetypeChunkAllocator
+    {
+    public:
+        static constexpr std::size_t chunk_size = 16 * 1024; ///< Bytes per chunk
+        static constexpr std::size_t column_alignment = 64;  ///< Minimum alignment of each column
+        static constexpr std::size_t npos = SIZE_MAX;        ///< Invalid row
+
+        /**
+         * @brief Construct an archetype with the given component set.
+         *
+         * @param components Layout of every component, in column order (must not be empty)
+         * @param max_chunks Number of chunks in the backing pool
+         * @throws assert if components is empty, an alignment is not a power of 2,
+         *         one entity does not fit in a chunk, or max_chunks == 0
+         */
+        ArchetypeChunkAllocator(std::span<const ComponentLayout> components, std::size_t max_chunks);
+
+        /** @brief Construct from a braced list, e.g. {component_layout<Position>(), component_layout<Velocity>()}. */
+        ArchetypeChunkAllocator(std::initializer_list<ComponentLayout> components, std::size_t max_chunks);
+
+        // Disable copy
+        ArchetypeChunkAllocator(const ArchetypeChunkAllocator&) = delete;
+        ArchetypeChunkAllocator& operator=(const ArchetypeChunkAllocator&) = delete;
+
+        // Enable move
+        ArchetypeChunkAllocator(ArchetypeChunkAllocator&& other) noexcept;
+        ArchetypeChunkAllocator& operator=(ArchetypeChunkAllocator&& other) noexcept;
+
+        /**
+         * @brief Append an entity.
+         *
+         * @return Row of the new entity (always size() - 1), or npos if the chunk pool is exhausted.
+         * @note Complexity: O(1) - takes a chunk from the pool when the last chunk is full
+         * @note Component storage is uninitialised.
+         */
+        std::size_t create();
+
+        /**
+         * @brief Remove an entity by moving the last entity into its row.
+         *
+         * @param row Row to remove (must be < size())
+         * @return Former row of the entity that now occupies @p row, or npos if @p row was last.
+         *         Callers keeping entity -> row maps update the moved entity with this.
+         * @note Complexity: O(components) - one memcpy per column
+         */
+        std::size_t destroy(std::size_t row);
+
+        /** @brief Remove every entity and return all chunks to the pool. */
+        void clear() noexcept;
+
+        /**
+         * @brief Get a pointer to one component of one entity.
+         *
+         * @param row Entity row (must be < size())
+         * @param component Column index (must be < component_count())
+         */
+        [[nodiscard]] void* component(std::size_t row, std::size_t component) const noexcept;
+
+        /** @brief Typed component(); T must match the layout of column @p component. */
+        template <typename T>
+        [[nodiscard]] T* component(const std::size_t row, const std::size_t component) const noexcept
+        {
+            return static_cast<T*>(this->component(row, component));
+        }
+
+        /**
+         * @brief Get the start of a column in a chunk.
+         *
+         * Entities 0..chunk_entities(chunk)-1 of the column are contiguous.
+         *
+         * @param chunk Chunk index (must be < chunk_count())
+         * @param component Column index (must be < component_count())
+         */
+        [[nodiscard]] void* column(std::size_t chunk, std::size_t component) const noexcept;
+
+        /** @brief Typed column(); T must match the layout of column @p component. */
+        template <typename T>
+        [[nodiscard]] T* column(const std::size_t chunk, const std::size_t component) const noexcept
+        {
+            return static_cast<T*>(this->column(chunk, component));
+        }
+
+        /** @brief Get the number of live entities in a chunk. */
+        [[nodiscard]] std::size_t chunk_entities(std::size_t chunk) const noexcept;
+
+        /** @brief Get the number of live entities. */
+        [[nodiscard]] std::size_t size() const noexcept { return size_; }
+
+        /** @brief Get the number of chunks in use. */
+        [[nodiscard]] std::size_t chunk_count() const noexcept { return chunks_.size(); }
+
+        /** @brief Get the number of entities stored per chunk. */
+        [[nodiscard]] std::size_t entities_per_chunk() const noexcept { return entities_per_chunk_; }
+
+        /** @brief Get the number of components (columns). */
+        [[nodiscard]] std::size_t component_count() const noexcept { return columns_.size(); }
+
+    private:
+        /**
+         * @brief Position of one component column inside every chunk.
+         */
+        struct Column
+        {
+            std::size_t offset; ///< Byte offset of the column from the chunk start
+            std::size_t size;   ///< Size of one component
+        };
+
+        std::vector<Column> columns_;
+        std::size_t entities_per_chunk_;
+        std::size_t size_;
+        std::vector<void*> chunks_; ///< Chunks in use, in row order
+        PoolAllocator chunk_pool_;
+
+        /**
+         * @brief Lay out columns for @p count entities.
+         * @return Total bytes needed, or SIZE_MAX if a column does not fit.
+         */
+        static std::size_t layout_columns(std::span<const ComponentLayout> components, std::size_t count,
+                                          std::vector<Column>& columns);
+
+        /** @brief Largest column alignment needed by @p components. */
+        static std::size_t max_alignment(std::span<const ComponentLayout> components) noexcept;
+    };
+} // namespace fast_alloc
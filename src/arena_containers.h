@@ -0,0 +1,643 @@
+#pragma once
+
+#include "allocator_concept.h"
+#include "stack_allocator.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <new>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+namespace fast_alloc
+{
+    /**
+     * @brief Growable array that lives in an arena and never frees.
+     *
+     * Built for per-request and per-frame scratch data: elements are trivially copyable, so
+     * there are no destructors to run and growth is a memcpy. When the buffer is the most recent
+     * allocation in the arena, growth extends it in place (StackAllocator::try_grow) instead of
+     * copying. Outgrown buffers are simply abandoned - the arena reclaims them on reset() - so
+     * deallocate is never called.
+     *
+     * Example:
+     * @code
+     * StackAllocator scratch(64 * 1024);
+     * ArenaVector<Hit> hits(scratch);
+     * for (const Ray& ray : rays) { hits.push_back(trace(ray)); }
+     * scratch.reset(); // Frees hits; no destructor needed
+     * @endcode
+     *
+     * @note Thread-safety: Not thread-safe.
+     * @note Operations that need memory return nullptr / false when the arena is exhausted and
+     *       leave the container unchanged.
+     * @warning The container must not be used after its memory is released by resetting the arena.
+     */
+    template <typename T, SizedAllocator Arena = StackAllocator>
+    class ArenaVector
+    {
+        static_assert(std::is_trivially_copyable_v<T>,
+                      "Arena containers copy elements with memcpy and never run destructors");
+
+    public:
+        using value_type = T;
+        using iterator = T*;
+        using const_iterator = const T*;
+
+        /**
+         * @brief Create an empty vector allocating from @p arena (which must outlive it).
+         * @param capacity Elements to reserve up front
+         */
+        explicit ArenaVector(Arena& arena, const std::size_t capacity = 0)
+            : arena_(&arena)
+              , data_(nullptr)
+              , size_(0)
+              , capacity_(0)
+        {
+            if (capacity > 0)
+            {
+                reserve(capacity);
+            }
+        }
+
+        // Disable copy
+        ArenaVector(const ArenaVector&) = delete;
+        ArenaVector& operator=(const ArenaVector&) = delete;
+
+        // Enable move
+        ArenaVector(ArenaVector&& other) noexcept
+            : arena_(other.arena_)
+              , data_(other.data_)
+              , size_(other.size_)
+              , capacity_(other.capacity_)
+        {
+            other.data_ = nullptr;
+            other.size_ = 0;
+            other.capacity_ = 0;
+        }
+
+        ArenaVector& operator=(ArenaVector&& other) noexcept
+        {
+            if (this != &other)
+            {
+                arena_ = other.arena_;
+                data_ = other.data_;
+                size_ = other.size_;
+                capacity_ = other.capacity_;
+
+                other.data_ = nullptr;
+                other.size_ = 0;
+                other.capacity_ = 0;
+            }
+            return *this;
+        }
+
+        /** @brief Append a copy of @p value; returns the new element, or nullptr if the arena is exhausted. */
+        T* push_back(const T& value)
+        {
+            return emplace_back(value);
+        }
+
+        /** @brief Construct an element at the end; returns it, or nullptr if the arena is exhausted. */
+        template <typename... Args>
+        T* emplace_back(Args&&... args)
+        {
+            if (size_ == capacity_ && !grow(size_ + 1))
+            {
+                return nullptr;
+            }
+            return new (data_ + size_++) T(std::forward<Args>(args)...);
+        }
+
+        /**
+         * @brief Append @p count elements from @p values.
+         * @return false (and nothing appended) if the arena is exhausted
+         */
+        bool append(const T* values, const std::size_t count)
+        {
+            if (size_ + count > capacity_ && !grow(size_ + count))
+            {
+                return false;
+            }
+            if (count > 0)
+            {
+                std::memcpy(data_ + size_, values, count * sizeof(T));
+            }
+            size_ += count;
+            return true;
+        }
+
+        /** @brief Remove the last element. */
+        void pop_back() noexcept
+        {
+            assert(size_ > 0 && "pop_back on empty ArenaVector");
+            --size_;
+        }
+
+        /**
+         * @brief Make room for at least @p capacity elements.
+         * @return false if the arena is exhausted
+         */
+        bool reserve(const std::size_t capacity)
+        {
+            return capacity <= capacity_ || grow_to(capacity);
+        }
+
+        /**
+         * @brief Change the size; new elements are value-initialised.
+         * @return false (and the size unchanged) if the arena is exhausted
+         */
+        bool resize(const std::size_t size)
+        {
+            if (size > capacity_ && !grow(size))
+            {
+                return false;
+            }
+            for (std::size_t i = size_; i < size; ++i)
+            {
+                new (data_ + i) T();
+            }
+            size_ = size;
+            return true;
+        }
+
+        /**
+         * @brief Remove every element, keeping the buffer.
+         * @note Complexity: O(1) - no destructors run
+         */
+        void clear() noexcept { size_ = 0; }
+
+        [[nodiscard]] T& operator[](const std::size_t index) noexcept
+        {
+            assert(index < size_ && "ArenaVector index out of range");
+            return data_[index];
+        }
+
+        [[nodiscard]] const T& operator[](const std::size_t index) const noexcept
+        {
+            assert(index < size_ && "ArenaVector index out of range");
+            return data_[index];
+        }
+
+        [[nodiscard]] T& back() noexcept { return (*this)[size_ - 1]; }
+        [[nodiscard]] const T& back() const noexcept { return (*this)[size_ - 1]; }
+
+        [[nodiscard]] T* data() noexcept { return data_; }
+        [[nodiscard]] const T* data() const noexcept { return data_; }
+        [[nodiscard]] iterator begin() noexcept { return data_; }
+        [[nodiscard]] iterator end() noexcept { return data_ + size_; }
+        [[nodiscard]] const_iterator begin() const noexcept { return data_; }
+        [[nodiscard]] const_iterator end() const noexcept { return data_ + size_; }
+
+        [[nodiscard]] std::size_t size() const noexcept { return size_; }
+        [[nodiscard]] std::size_t capacity() const noexcept { return capacity_; }
+        [[nodiscard]] bool empty() const noexcept { return size_ == 0; }
+
+        /** @brief Get the arena this vector allocates from. */
+        [[nodiscard]] Arena& arena() const noexcept { return *arena_; }
+
+    private:
+        static constexpr std::size_t min_capacity = 8;
+
+        Arena* arena_;
+        T* data_;
+        std::size_t size_;
+        std::size_t capacity_;
+
+        /** @brief Grow geometrically to hold at least @p needed elements, falling back to exactly @p needed. */
+        bool grow(const std::size_t needed)
+        {
+            const std::size_t doubled = std::max({needed, capacity_ * 2, min_capacity});
+            return grow_to(doubled) || (doubled > needed && grow_to(needed));
+        }
+
+        /** @brief Resize the buffer to @p capacity elements, in place if it is the arena's top allocation. */
+        bool grow_to(const std::size_t capacity)
+        {
+            if constexpr (requires(Arena& a) { a.try_grow(static_cast<void*>(nullptr), std::size_t{}, std::size_t{}); })
+            {
+                if (data_ && arena_->try_grow(data_, capacity_ * sizeof(T), capacity * sizeof(T)))
+                {
+                    capacity_ = capacity;
+                    return true;
+                }
+            }
+
+            void* memory = arena_->allocate(capacity * sizeof(T), alignof(T));
+            if (!memory)
+            {
+                return false;
+            }
+
+            // The old buffer is left to the arena
+            if (size_ > 0)
+            {
+                std::memcpy(memory, data_, size_ * sizeof(T));
+            }
+            data_ = static_cast<T*>(memory);
+            capacity_ = capacity;
+            return true;
+        }
+    };
+
+    /**
+     * @brief Growable, NUL-terminated string that lives in an arena and never frees.
+     *
+     * An ArenaVector<char> that keeps a terminator after the last character, so c_str() is free.
+     * Appending to the most recently allocated string in the arena extends it in place.
+     *
+     * @note Operations that need memory return false when the arena is exhausted and leave the
+     *       string unchanged.
+     */
+    template <SizedAllocator Arena = StackAllocator>
+    class ArenaString
+    {
+    public:
+        /** @brief Create an empty string allocating from @p arena (which must outlive it). */
+        explicit ArenaString(Arena& arena)
+            : chars_(arena)
+        {
+        }
+
+        /** @brief Create a copy of @p text in @p arena. Check empty() against @p text for exhaustion. */
+        ArenaString(Arena& arena, const std::string_view text)
+            : chars_(arena)
+        {
+            append(text);
+        }
+
+        /** @brief Append @p text; false if the arena is exhausted. */
+        bool append(const std::string_view text)
+        {
+            // Room for the terminator first, so a failure leaves the string untouched
+            const std::size_t needed = chars_.size() + text.size() + 1;
+            if (needed > chars_.capacity()
+                && !chars_.reserve(std::max(needed, chars_.capacity() * 2)) && !chars_.reserve(needed))
+            {
+                return false;
+            }
+            chars_.append(text.data(), text.size());
+            chars_.data()[chars_.size()] = '\0';
+            return true;
+        }
+
+        /** @brief Append one character; false if the arena is exhausted. */
+        bool push_back(const char c)
+        {
+            return append(std::string_view(&c, 1));
+        }
+
+        /**
+         * @brief Remove every character, keeping the buffer.
+         * @note Complexity: O(1)
+         */
+        void clear() noexcept
+        {
+            chars_.clear();
+            if (chars_.capacity() > 0)
+            {
+                chars_.data()[0] = '\0';
+            }
+        }
+
+        /** @brief Get the characters as a NUL-terminated C string. */
+        [[nodiscard]] const char* c_str() const noexcept { return chars_.capacity() > 0 ? chars_.data() : ""; }
+
+        /** @brief Get a view of the characters. */
+        [[nodiscard]] std::string_view view() const noexcept { return {c_str(), chars_.size()}; }
+
+        operator std::string_view() const noexcept { return view(); }
+
+        [[nodiscard]] char operator[](const std::size_t index) const noexcept { return chars_[index]; }
+
+        [[nodiscard]] std::size_t size() const noexcept { return chars_.size(); }
+        [[nodiscard]] bool empty() const noexcept { return chars_.empty(); }
+
+        friend bool operator==(const ArenaString& lhs, const std::string_view rhs) noexcept
+        {
+            return lhs.view() == rhs;
+        }
+
+    private:
+        ArenaVector<char, Arena> chars_;
+    };
+
+    /**
+     * @brief Open-addressing hash map that lives in an arena and never frees.
+     *
+     * Linear probing over a power-of-2 slot array, kept at most 3/4 full. Every slot carries a
+     * generation stamp and is live only while it matches the map's generation, so clear() just
+     * bumps the generation: O(1) however many entries there are, with the slot array kept for
+     * reuse. Keys and values are trivially copyable, so no destructors ever run. When the map
+     * outgrows its slots it rehashes into a larger array and leaves the old one to the arena.
+     *
+     * Example:
+     * @code
+     * StackAllocator request_arena(256 * 1024);
+     * ArenaHashMap<std::string_view, std::uint32_t> counts(request_arena);
+     * for (std::string_view word : words) { ++*counts.insert(word, 0).first; }
+     * @endcode
+     *
+     * @note Thread-safety: Not thread-safe.
+     * @warning Pointers to values are invalidated by any insertion that grows the map, and by erase().
+     */
+    template <typename K, typename V, typename Hash = std::hash<K>, typename Equal = std::equal_to<K>,
+              SizedAllocator Arena = StackAllocator>
+    class ArenaHashMap
+    {
+        static_assert(std::is_trivially_copyable_v<K> && std::is_trivially_copyable_v<V>,
+                      "Arena containers copy entries with memcpy and never run destructors");
+
+    public:
+        /**
+         * @brief Create an empty map allocating from @p arena (which must outlive it).
+         * @param capacity Entries to make room for up front
+         */
+        explicit ArenaHashMap(Arena& arena, const std::size_t capacity = 0)
+            : arena_(&arena)
+              , slots_(nullptr)
+              , slot_count_(0)
+              , size_(0)
+              , generation_(1)
+        {
+            if (capacity > 0)
+            {
+                reserve(capacity);
+            }
+        }
+
+        // Disable copy
+        ArenaHashMap(const ArenaHashMap&) = delete;
+        ArenaHashMap& operator=(const ArenaHashMap&) = delete;
+
+        // Enable move
+        ArenaHashMap(ArenaHashMap&& other) noexcept
+            : arena_(other.arena_)
+              , slots_(other.slots_)
+              , slot_count_(other.slot_count_)
+              , size_(other.size_)
+              , generation_(other.generation_)
+        {
+            other.slots_ = nullptr;
+            other.slot_count_ = 0;
+            other.size_ = 0;
+        }
+
+        ArenaHashMap& operator=(ArenaHashMap&& other) noexcept
+        {
+            if (this != &other)
+            {
+                arena_ = other.arena_;
+                slots_ = other.slots_;
+                slot_count_ = other.slot_count_;
+                size_ = other.size_;
+                generation_ = other.generation_;
+
+                other.slots_ = nullptr;
+                other.slot_count_ = 0;
+                other.size_ = 0;
+            }
+            return *this;
+        }
+
+        /**
+         * @brief Insert @p key with @p value unless it is already present.
+         *
+         * @return The value stored for @p key and whether it was inserted, or {nullptr, false}
+         *         if the map had to grow and the arena is exhausted.
+         * @note Complexity: O(1) average
+         */
+        std::pair<V*, bool> insert(const K& key, const V& value)
+        {
+            if (V* existing = find(key))
+            {
+                return {existing, false};
+            }
+
+            // Keep the load factor at or below 3/4
+            if ((size_ + 1) * 4 > slot_count_ * 3 && !rehash(std::max(slot_count_ * 2, min_slots)))
+            {
+                return {nullptr, false};
+            }
+
+            Slot& slot = slots_[probe_free(key)];
+            slot.generation = generation_;
+            new (&slot.key) K(key);
+            new (&slot.value) V(value);
+            ++size_;
+
+            return {&slot.value, true};
+        }
+
+        /** @brief Insert @p key or overwrite its value; nullptr if the arena is exhausted. */
+        V* insert_or_assign(const K& key, const V& value)
+        {
+            auto [stored, inserted] = insert(key, value);
+            if (stored && !inserted)
+            {
+                *stored = value;
+            }
+            return stored;
+        }
+
+        /** @brief Get the value stored for @p key, or nullptr. */
+        [[nodiscard]] V* find(const K& key) noexcept
+        {
+            const std::size_t index = find_index(key);
+            return index < slot_count_ ? &slots_[index].value : nullptr;
+        }
+
+        /** @brief Get the value stored for @p key, or nullptr. */
+        [[nodiscard]] const V* find(const K& key) const noexcept
+        {
+            const std::size_t index = find_index(key);
+            return index < slot_count_ ? &slots_[index].value : nullptr;
+        }
+
+        [[nodiscard]] bool contains(const K& key) const noexcept { return find(key) != nullptr; }
+
+        /**
+         * @brief Remove @p key.
+         * @return true if it was present
+         * @note Shifts later entries of the probe run back, so no tombstones accumulate.
+         */
+        bool erase(const K& key) noexcept
+        {
+            std::size_t hole = find_index(key);
+            if (hole >= slot_count_)
+            {
+                return false;
+            }
+
+            const std::size_t mask = slot_count_ - 1;
+            for (std::size_t next = (hole + 1) & mask; live(next); next = (next + 1) & mask)
+            {
+                // Move an entry back only if the hole lies on its probe path
+                const std::size_t home = ideal_slot(slots_[next].key);
+                if (((next - home) & mask) >= ((next - hole) & mask))
+                {
+                    std::memcpy(static_cast<void*>(&slots_[hole]), &slots_[next], sizeof(Slot));
+                    hole = next;
+                }
+            }
+
+            slots_[hole].generation = 0;
+            --size_;
+            return true;
+        }
+
+        /**
+         * @brief Make room for at least @p capacity entries without growing.
+         * @return false if the arena is exhausted
+         */
+        bool reserve(const std::size_t capacity)
+        {
+            std::size_t slots = min_slots;
+            while (slots * 3 < capacity * 4)
+            {
+                slots *= 2;
+            }
+            return slots <= slot_count_ || rehash(slots);
+        }
+
+        /**
+         * @brief Remove every entry, keeping the slot array.
+         * @note Complexity: O(1) - advances the generation stamp
+         */
+        void clear() noexcept
+        {
+            size_ = 0;
+            if (++generation_ == 0)
+            {
+                // Stamps wrapped: old entries could look live again, so wipe them once
+                for (std::size_t i = 0; i < slot_count_; ++i)
+                {
+                    slots_[i].generation = 0;
+                }
+                generation_ = 1;
+            }
+        }
+
+        /** @brief Call @p visit(key, value) for every entry, in slot order. */
+        template <typename Visitor>
+        void for_each(Visitor&& visit)
+        {
+            for (std::size_t i = 0; i < slot_count_; ++i)
+            {
+                if (live(i))
+                {
+                    visit(static_cast<const K&>(slots_[i].key), slots_[i].value);
+                }
+            }
+        }
+
+        [[nodiscard]] std::size_t size() const noexcept { return size_; }
+        [[nodiscard]] bool empty() const noexcept { return size_ == 0; }
+
+        /** @brief Get the number of slots (entries fit up to 3/4 of it before growing). */
+        [[nodiscard]] std::size_t slot_count() const noexcept { return slot_count_; }
+
+        /** @brief Get the arena this map allocates from. */
+        [[nodiscard]] Arena& arena() const noexcept { return *arena_; }
+
+    private:
+        static constexpr std::size_t min_slots = 16;
+
+        /**
+         * @brief One entry; live while generation matches the map's.
+         */
+        struct Slot
+        {
+            std::uint32_t generation;
+            K key;
+            V value;
+        };
+
+        Arena* arena_;
+        Slot* slots_;
+        std::size_t slot_count_; ///< Power of 2, or 0 before the first insertion
+        std::size_t size_;
+        std::uint32_t generation_; ///< Never 0, so a zeroed stamp is always free
+
+        [[nodiscard]] bool live(const std::size_t index) const noexcept
+        {
+            return slots_[index].generation == generation_;
+        }
+
+        [[nodiscard]] std::size_t ideal_slot(const K& key) const noexcept
+        {
+            return Hash{}(key) & (slot_count_ - 1);
+        }
+
+        /** @brief Index of the live slot holding @p key, or slot_count_ if absent. */
+        [[nodiscard]] std::size_t find_index(const K& key) const noexcept
+        {
+            if (size_ == 0)
+            {
+                return slot_count_;
+            }
+
+            const std::size_t mask = slot_count_ - 1;
+            for (std::size_t index = ideal_slot(key); live(index); index = (index + 1) & mask)
+            {
+                if (Equal{}(slots_[index].key, key))
+                {
+                    return index;
+                }
+            }
+            return slot_count_;
+        }
+
+        /** @brief Index of the first free slot on @p key's probe path; the map must not be full. */
+        [[nodiscard]] std::size_t probe_free(const K& key) const noexcept
+        {
+            const std::size_t mask = slot_count_ - 1;
+            std::size_t index = ideal_slot(key);
+            while (live(index))
+            {
+                index = (index + 1) & mask;
+            }
+            return index;
+        }
+
+        /** @brief Move every entry into a new array of @p slot_count slots; the old array is left to the arena. */
+        bool rehash(const std::size_t slot_count)
+        {
+            void* memory = arena_->allocate(slot_count * sizeof(Slot), alignof(Slot));
+            if (!memory)
+            {
+                return false;
+            }
+
+            auto* const slots = static_cast<Slot*>(memory);
+            for (std::size_t i = 0; i < slot_count; ++i)
+            {
+                slots[i].generation = 0;
+            }
+
+            Slot* const old_slots = slots_;
+            const std::size_t old_count = slot_count_;
+            const std::uint32_t old_generation = generation_;
+
+            slots_ = slots;
+            slot_count_ = slot_count;
+            generation_ = 1;
+
+            for (std::size_t i = 0; i < old_count; ++i)
+            {
+                if (old_slots[i].generation == old_generation)
+                {
+                    const std::size_t index = probe_free(old_slots[i].key);
+                    std::memcpy(static_cast<void*>(&slots_[index]), &old_slots[i], sizeof(Slot));
+                    slots_[index].generation = generation_;
+                }
+            }
+
+            return true;
+        }
+    };
+} // namespace fast_alloc
@@ -0,0 +1,109 @@
+#include "binned_arena_allocator.h"
+
+#include <bit>
+#include <cassert>
+#include <utility>
+
+namespace fast_alloc
+{
+    BinnedArenaAllocator::BinnedArenaAllocator(const std::size_t size)
+        : arena_(size)
+          , bins_{}
+          , recycled_bytes_(0)
+    {
+        static_assert(min_binned_size >= sizeof(void*), "Bins store a next pointer in each chunk");
+        static_assert(min_binned_size << (bin_count - 1) == max_binned_size, "Bin count must cover all classes");
+    }
+
+    BinnedArenaAllocator::BinnedArenaAllocator(BinnedArenaAllocator&& other) noexcept
+        : arena_(std::move(other.arena_))
+          , bins_(other.bins_)
+          , recycled_bytes_(other.recycled_bytes_)
+    {
+        other.bins_ = {};
+        other.recycled_bytes_ = 0;
+    }
+
+    BinnedArenaAllocator& BinnedArenaAllocator::operator=(BinnedArenaAllocator&& other) noexcept
+    {
+        if (this != &other)
+        {
+            arena_ = std::move(other.arena_);
+            bins_ = other.bins_;
+            recycled_bytes_ = other.recycled_bytes_;
+
+            other.bins_ = {};
+            other.recycled_bytes_ = 0;
+        }
+        return *this;
+    }
+
+    void* BinnedArenaAllocator::allocate(const std::size_t size, const std::size_t alignment)
+    {
+        assert(size > 0 && "Allocation size must be greater than zero");
+
+        if (!is_binned(size, alignment))
+        {
+            return arena_.allocate(size, alignment);
+        }
+
+        const std::size_t bin = bin_index(size);
+        const std::size_t class_size = min_binned_size << bin;
+
+        // Recycled chunk first
+        if (void* chunk = bins_[bin])
+        {
+            bins_[bin] = *static_cast<void**>(chunk);
+            recycled_bytes_ -= class_size;
+            return chunk;
+        }
+
+        return arena_.allocate(class_size, alignof(std::max_align_t));
+    }
+
+    void BinnedArenaAllocator::deallocate(void* ptr, const std::size_t size, const std::size_t alignment)
+    {
+        if (!ptr)
+        {
+            return;
+        }
+
+        const bool binned = is_binned(size, alignment);
+        const std::size_t bytes = binned ? min_binned_size << bin_index(size) : size;
+
+        // Most recent allocation - give it straight back to the bump pointer
+        if (static_cast<std::byte*>(ptr) + bytes == arena_.get_marker())
+        {
+            arena_.reset(ptr);
+            return;
+        }
+
+        if (binned)
+        {
+            const std::size_t bin = bin_index(size);
+            *static_cast<void**>(ptr) = bins_[bin];
+            bins_[bin] = ptr;
+            recycled_bytes_ += bytes;
+        }
+
+        // Unbinned chunks are reclaimed by reset()
+    }
+
+    void BinnedArenaAllocator::reset() noexcept
+    {
+        arena_.reset();
+        bins_ = {};
+        recycled_bytes_ = 0;
+    }
+
+    bool BinnedArenaAllocator::is_binned(const std::size_t size, const std::size_t alignment) noexcept
+    {
+        return size <= max_binned_size && alignment <= alignof(std::max_align_t);
+    }
+
+    std::size_t BinnedArenaAllocator::bin_index(const std::size_t size) noexcept
+    {
+        const std::size_t class_size = size <= min_binned_size ? min_binned_size : std::bit_ceil(size);
+        return static_cast<std::size_t>(std::countr_zero(class_size) - std::countr_zero(min_binned_size));
+    }
+} // namespace fast_alloc
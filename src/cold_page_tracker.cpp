@@ -0,0 +1,208 @@
+#include "cold_page_tracker.h"
+#include "stack_allocator.h"
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <utility>
+
+#ifdef __linux__
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace fast_alloc
+{
+    namespace
+    {
+        std::size_t page_size() noexcept
+        {
+#ifdef __linux__
+            return static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+#else
+            return 4096;
+#endif
+        }
+    } // namespace
+
+    ColdPageTracker::ColdPageTracker(void* base, const std::size_t size, const std::size_t span_size,
+                                     const std::uint32_t idle_ticks)
+        : begin_(0)
+          , end_(0)
+          , span_shift_(0)
+          , idle_ticks_(idle_ticks)
+          , epoch_(0)
+    {
+        assert(span_size > 0 && "Span size must be greater than zero");
+        assert(idle_ticks > 0 && "Idle ticks must be greater than zero");
+
+        // Spans are a power-of-2 number of whole pages, so the span index is a shift
+        const std::size_t page = page_size();
+        const std::size_t span = std::bit_ceil(span_size < page ? page : span_size);
+        span_shift_ = static_cast<std::size_t>(std::countr_zero(span));
+
+        // Only advise pages that lie entirely inside the range
+        const auto start = reinterpret_cast<std::uintptr_t>(base);
+        begin_ = (start + page - 1) & ~(page - 1);
+        end_ = (start + size) & ~(page - 1);
+        if (end_ < begin_)
+        {
+            end_ = begin_;
+        }
+
+        const std::size_t spans = (end_ - begin_ + span - 1) >> span_shift_;
+        last_access_ = std::make_unique<std::atomic<std::uint32_t>[]>(spans);
+        demoted_at_.assign(spans, 0);
+    }
+
+    ColdPageTracker::ColdPageTracker(const StackAllocator& stack, const std::size_t span_size,
+                                     const std::uint32_t idle_ticks)
+        : ColdPageTracker(stack.data(), stack.capacity(), span_size, idle_ticks)
+    {
+    }
+
+    ColdPageTracker::ColdPageTracker(ColdPageTracker&& other) noexcept
+        : begin_(other.begin_)
+          , end_(other.end_)
+          , span_shift_(other.span_shift_)
+          , idle_ticks_(other.idle_ticks_)
+          , epoch_(other.epoch_.load(std::memory_order_relaxed))
+          , last_access_(std::move(other.last_access_))
+          , demoted_at_(std::move(other.demoted_at_))
+    {
+        other.begin_ = 0;
+        other.end_ = 0;
+    }
+
+    ColdPageTracker& ColdPageTracker::operator=(ColdPageTracker&& other) noexcept
+    {
+        if (this != &other)
+        {
+            begin_ = other.begin_;
+            end_ = other.end_;
+            span_shift_ = other.span_shift_;
+            idle_ticks_ = other.idle_ticks_;
+            epoch_.store(other.epoch_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+            last_access_ = std::move(other.last_access_);
+            demoted_at_ = std::move(other.demoted_at_);
+
+            other.begin_ = 0;
+            other.end_ = 0;
+        }
+        return *this;
+    }
+
+    void ColdPageTracker::touch(const void* ptr, const std::size_t size) noexcept
+    {
+        if (size == 0 || end_ == begin_)
+        {
+            return;
+        }
+
+        // Clamp to the tracked pages
+        const auto start = reinterpret_cast<std::uintptr_t>(ptr);
+        const std::uintptr_t first = start < begin_ ? begin_ : start;
+        const std::uintptr_t last = start + size > end_ ? end_ : start + size;
+        if (first >= last)
+        {
+            return;
+        }
+
+        const std::uint32_t now = epoch_.load(std::memory_order_relaxed);
+        for (std::size_t span = (first - begin_) >> span_shift_; span <= (last - 1 - begin_) >> span_shift_; ++span)
+        {
+            last_access_[span].store(now, std::memory_order_relaxed);
+        }
+    }
+
+    std::size_t ColdPageTracker::demote(const ColdAdvice advice)
+    {
+        const std::uint32_t now = epoch_.load(std::memory_order_relaxed);
+
+        std::size_t demoted = 0;
+        std::size_t run_start = 0;
+        std::vector<std::uint32_t> run_marks; // demoted_at_ values for the spans of the run
+
+        const auto flush_run = [&]
+        {
+            if (run_marks.empty())
+            {
+                return;
+            }
+
+            // Spans whose advice failed stay eligible for the next demote()
+            const std::uintptr_t begin = begin_ + (run_start << span_shift_);
+            const std::uintptr_t end = std::min<std::uintptr_t>(begin + (run_marks.size() << span_shift_), end_);
+            if (advise(begin, end - begin, advice))
+            {
+                std::copy(run_marks.begin(), run_marks.end(),
+                          demoted_at_.begin() + static_cast<std::ptrdiff_t>(run_start));
+                demoted += end - begin;
+            }
+            run_marks.clear();
+        };
+
+        for (std::size_t i = 0; i < demoted_at_.size(); ++i)
+        {
+            const std::uint32_t last = last_access_[i].load(std::memory_order_relaxed);
+
+            // Idle long enough, and not demoted since the latest touch
+            if (now - last >= idle_ticks_ && demoted_at_[i] != last + 1)
+            {
+                if (run_marks.empty())
+                {
+                    run_start = i;
+                }
+                run_marks.push_back(last + 1);
+            }
+            else
+            {
+                flush_run();
+            }
+        }
+        flush_run();
+
+        return demoted;
+    }
+
+    bool ColdPageTracker::supported() noexcept
+    {
+#if defined(__linux__) && defined(MADV_COLD)
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    std::size_t ColdPageTracker::demoted_spans() const noexcept
+    {
+        std::size_t count = 0;
+        for (std::size_t i = 0; i < demoted_at_.size(); ++i)
+        {
+            if (demoted_at_[i] == last_access_[i].load(std::memory_order_relaxed) + 1)
+            {
+                ++count;
+            }
+        }
+        return count;
+    }
+
+    void ColdPageTracker::set_idle_ticks(const std::uint32_t ticks) noexcept
+    {
+        assert(ticks > 0 && "Idle ticks must be greater than zero");
+        idle_ticks_ = ticks;
+    }
+
+    bool ColdPageTracker::advise(const std::uintptr_t begin, const std::size_t bytes, const ColdAdvice advice) noexcept
+    {
+#if defined(__linux__) && defined(MADV_COLD)
+        const int hint = advice == ColdAdvice::PageOut ? MADV_PAGEOUT : MADV_COLD;
+        return madvise(reinterpret_cast<void*>(begin), bytes, hint) == 0;
+#else
+        (void)begin;
+        (void)bytes;
+        (void)advice;
+        return false;
+#endif
+    }
+} // namespace fast_alloc
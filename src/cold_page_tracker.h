@@ -0,0 +1,152 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace fast_alloc
+{
+    template <typename Config>
+    class BasicPoolAllocator;
+    class StackAllocator;
+
+    /**
+     * @brief Kernel hint used to demote idle spans.
+     */
+    enum class ColdAdvice
+    {
+        Cold,   ///< MADV_COLD: deactivate pages so they are reclaimed first under pressure
+        PageOut ///< MADV_PAGEOUT: reclaim (swap out) the pages now
+    };
+
+    /**
+     * @brief Access-age tracking for a pool or arena, demoting idle spans to the kernel.
+     *
+     * The tracked range is split into spans of whole pages. Callers touch() the memory they
+     * use and advance an epoch with tick() (e.g. once per second or per frame). demote() then
+     * hints every span not touched for idle_ticks epochs with MADV_COLD or MADV_PAGEOUT, so the
+     * kernel reclaims rarely-used parts of large lookup pools first under pressure while hot
+     * spans stay resident. Contents are preserved: a demoted page is simply faulted back in
+     * (from swap, if it was paged out) on next access.
+     *
+     * Example:
+     * @code
+     * PoolAllocator lookup(sizeof(Entry), 1'000'000);
+     * ColdPageTracker ages(lookup, 256 * 1024, 30);
+     * // On every access: ages.touch(entry);
+     * // Once per second:  ages.tick(); ages.demote();
+     * @endcode
+     *
+     * @note Thread-safety: touch() may be called from any thread concurrently with tick() and
+     *       demote(); tick() and demote() must be called from one thread at a time.
+     * @note Memory overhead: 8 bytes per span.
+     * @note Platform: Linux 5.4+ (MADV_COLD, MADV_PAGEOUT). Elsewhere demote() is a no-op and
+     *       supported() returns false.
+     */
+    class ColdPageTracker
+    {
+    public:
+        static constexpr std::size_t default_span_size = 64 * 1024; ///< Bytes per tracked span
+
+        /**
+         * @brief Track [base, base + size).
+         *
+         * Only the whole pages inside the range are tracked; partial pages at either end are
+         * never advised, since they may share a page with unrelated memory.
+         *
+         * @param base Start of the range
+         * @param size Size of the range in bytes
+         * @param span_size Tracking granularity in bytes (rounded up to whole pages)
+         * @param idle_ticks Epochs without a touch() before a span is demoted (must be > 0)
+         */
+        ColdPageTracker(void* base, std::size_t size, std::size_t span_size = default_span_size,
+                        std::uint32_t idle_ticks = 1);
+
+        /** @brief Track the memory of @p pool. */
+        template <typename Config>
+        explicit ColdPageTracker(const BasicPoolAllocator<Config>& pool, const std::size_t span_size = default_span_size,
+                                 const std::uint32_t idle_ticks = 1)
+            : ColdPageTracker(pool.data(), pool.block_stride() * pool.capacity(), span_size, idle_ticks)
+        {
+        }
+
+        /** @brief Track the memory of @p stack. */
+        explicit ColdPageTracker(const StackAllocator& stack, std::size_t span_size = default_span_size,
+                                 std::uint32_t idle_ticks = 1);
+
+        // Disable copy
+        ColdPageTracker(const ColdPageTracker&) = delete;
+        ColdPageTracker& operator=(const ColdPageTracker&) = delete;
+
+        // Enable move
+        ColdPageTracker(ColdPageTracker&& other) noexcept;
+        ColdPageTracker& operator=(ColdPageTracker&& other) noexcept;
+
+        /**
+         * @brief Mark the span containing @p ptr as used in the current epoch.
+         * @note Complexity: O(1) - one shift and one relaxed store. Pointers outside the tracked
+         *       pages are ignored.
+         */
+        void touch(const void* ptr) noexcept
+        {
+            const std::size_t offset = reinterpret_cast<std::uintptr_t>(ptr) - begin_;
+            if (offset < end_ - begin_)
+            {
+                last_access_[offset >> span_shift_].store(epoch_.load(std::memory_order_relaxed),
+                                                          std::memory_order_relaxed);
+            }
+        }
+
+        /** @brief Mark every span overlapping [ptr, ptr + size) as used. */
+        void touch(const void* ptr, std::size_t size) noexcept;
+
+        /** @brief Advance the epoch. */
+        void tick() noexcept { epoch_.fetch_add(1, std::memory_order_relaxed); }
+
+        /**
+         * @brief Hint every span idle for at least idle_ticks epochs and not yet demoted.
+         *
+         * Adjacent idle spans are advised with a single madvise() call.
+         *
+         * @param advice MADV_COLD (default) or MADV_PAGEOUT
+         * @return Bytes newly demoted
+         * @note Complexity: O(span_count())
+         */
+        std::size_t demote(ColdAdvice advice = ColdAdvice::Cold);
+
+        /** @brief Check whether demote() can advise the kernel on this platform. */
+        [[nodiscard]] static bool supported() noexcept;
+
+        /** @brief Get the number of tracked spans. */
+        [[nodiscard]] std::size_t span_count() const noexcept { return demoted_at_.size(); }
+
+        /** @brief Get the span size in bytes. */
+        [[nodiscard]] std::size_t span_size() const noexcept { return std::size_t{1} << span_shift_; }
+
+        /** @brief Get the number of spans demoted and not touched since. */
+        [[nodiscard]] std::size_t demoted_spans() const noexcept;
+
+        /** @brief Get the current epoch. */
+        [[nodiscard]] std::uint32_t epoch() const noexcept { return epoch_.load(std::memory_order_relaxed); }
+
+        /** @brief Get the epochs a span must stay idle before demote() advises it. */
+        [[nodiscard]] std::uint32_t idle_ticks() const noexcept { return idle_ticks_; }
+
+        /** @brief Set the epochs a span must stay idle before demote() advises it (must be > 0). */
+        void set_idle_ticks(std::uint32_t ticks) noexcept;
+
+    private:
+        std::uintptr_t begin_; ///< First tracked page
+        std::uintptr_t end_;   ///< End of the last tracked page
+        std::size_t span_shift_;
+        std::uint32_t idle_ticks_;
+        std::atomic<std::uint32_t> epoch_;
+        std::unique_ptr<std::atomic<std::uint32_t>[]> last_access_; ///< Epoch of the latest touch per span
+        std::vector<std::uint32_t> demoted_at_; ///< last_access + 1 when demoted, 0 if resident
+
+        /** @brief Advise @p bytes of whole pages starting at @p begin. */
+        static bool advise(std::uintptr_t begin, std::size_t bytes, ColdAdvice advice) noexcept;
+    };
+} // namespace fast_alloc
@@ -0,0 +1,121 @@
+#include "deferred_free_queue.h"
+
+namespace fast_alloc
+{
+    DeferredFreeQueue::DeferredFreeQueue(const AllocatorHandle& target) noexcept
+        : target_(target)
+          , head_(&stub_)
+          , tail_(&stub_)
+          , stub_{{nullptr}, 0, 0}
+    {
+    }
+
+    DeferredFreeQueue::~DeferredFreeQueue()
+    {
+        stop_worker();
+        drain();
+    }
+
+    DeferredFreeQueue::Node* DeferredFreeQueue::pop() noexcept
+    {
+        Node* tail = tail_;
+        Node* next = tail->next.load(std::memory_order_acquire);
+
+        // Step over the stub
+        if (tail == &stub_)
+        {
+            if (!next)
+            {
+                return nullptr; // Empty
+            }
+            tail_ = next;
+            tail = next;
+            next = next->next.load(std::memory_order_acquire);
+        }
+
+        if (next)
+        {
+            tail_ = next;
+            return tail;
+        }
+
+        // tail is the last linked node. If a producer has swapped head_ but not yet linked its
+        // node, wait for the next drain rather than spinning.
+        if (tail != head_.load(std::memory_order_acquire))
+        {
+            return nullptr;
+        }
+
+        // Re-insert the stub behind tail so tail can be detached
+        stub_.next.store(nullptr, std::memory_order_relaxed);
+        link(&stub_);
+
+        next = tail->next.load(std::memory_order_acquire);
+        if (next)
+        {
+            tail_ = next;
+            return tail;
+        }
+
+        return nullptr;
+    }
+
+    std::size_t DeferredFreeQueue::drain(const std::size_t max_count)
+    {
+        std::lock_guard lock(consumer_mutex_);
+
+        std::size_t count = 0;
+        while (count < max_count)
+        {
+            Node* node = pop();
+            if (!node)
+            {
+                break;
+            }
+
+            const std::size_t size = node->size;
+            const std::size_t alignment = node->alignment;
+            target_.deallocate(node, size, alignment);
+            ++count;
+        }
+
+        freed_.fetch_add(count, std::memory_order_relaxed);
+        return count;
+    }
+
+    void DeferredFreeQueue::start_worker(const std::chrono::microseconds interval)
+    {
+        assert(!worker_.joinable() && "Worker already running");
+
+        stop_requested_ = false;
+        worker_ = std::thread([this, interval]
+        {
+            std::unique_lock lock(worker_mutex_);
+            while (!stop_requested_)
+            {
+                lock.unlock();
+                drain();
+                lock.lock();
+
+                worker_wake_.wait_for(lock, interval, [this] { return stop_requested_; });
+            }
+        });
+    }
+
+    void DeferredFreeQueue::stop_worker()
+    {
+        if (!worker_.joinable())
+        {
+            return;
+        }
+
+        {
+            std::lock_guard lock(worker_mutex_);
+            stop_requested_ = true;
+        }
+        worker_wake_.notify_one();
+        worker_.join();
+
+        drain();
+    }
+} // namespace fast_alloc
@@ -0,0 +1,159 @@
+#pragma once
+
+#include "allocator_context.h"
+
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <new>
+#include <thread>
+
+namespace fast_alloc
+{
+    /**
+     * @brief Offloads deallocation from real-time threads to a background thread.
+     *
+     * Real-time threads (audio, render) push() pointers instead of freeing them; a consumer -
+     * the built-in worker thread or any thread calling drain() - later performs the actual
+     * deallocate calls in batches. push() is wait-free: one atomic exchange and one store, no
+     * matter how slow the target allocator's deallocate is (FreeListAllocator's sorted insert,
+     * a contended ThreadSafePoolAllocator lock).
+     *
+     * The queue is an intrusive multi-producer single-consumer list (Vyukov): the queue node is
+     * written into the memory being freed, so pushing never allocates.
+     *
+     * Example:
+     * @code
+     * DeferredFreeQueue deferred(sample_heap);
+     * deferred.start_worker();
+     * // Audio callback:
+     * deferred.push(finished_buffer, buffer_size);
+     * @endcode
+     *
+     * @note Thread-safety: push() may be called from any number of threads concurrently with
+     *       drain() and the worker. drain() calls are serialised internally.
+     * @note The target allocator is only ever called from the consuming thread; it must be safe
+     *       to deallocate from that thread while others allocate (e.g. a thread-safe pool, or an
+     *       allocator only the consumer otherwise touches).
+     * @warning Every pushed allocation must be at least min_size bytes and aligned to
+     *          alignof(void*); its contents are overwritten by the queue.
+     */
+    class DeferredFreeQueue
+    {
+    public:
+        /**
+         * @brief Intrusive queue node, stored in the first bytes of each pushed allocation.
+         */
+        struct Node
+        {
+            std::atomic<Node*> next;
+            std::uint32_t size;
+            std::uint32_t alignment;
+        };
+
+        static constexpr std::size_t min_size = sizeof(Node); ///< Smallest allocation push() accepts
+
+        /** @brief Queue frees for @p target (which must outlive the queue). */
+        explicit DeferredFreeQueue(const AllocatorHandle& target) noexcept;
+
+        /** @brief Queue frees for @p allocator (which must outlive the queue). */
+        template <Allocator A>
+            requires (!std::is_same_v<std::remove_cv_t<A>, AllocatorHandle>)
+        explicit DeferredFreeQueue(A& allocator) noexcept
+            : DeferredFreeQueue(AllocatorHandle::of(allocator))
+        {
+        }
+
+        /** @brief Stop the worker and free everything still queued. No push() may be in flight. */
+        ~DeferredFreeQueue();
+
+        // Pinned: producers and the consumer hold pointers into the queue
+        DeferredFreeQueue(const DeferredFreeQueue&) = delete;
+        DeferredFreeQueue& operator=(const DeferredFreeQueue&) = delete;
+
+        /**
+         * @brief Queue @p ptr to be returned to the target allocator.
+         *
+         * @param ptr Allocation to free (nullptr is safely ignored)
+         * @param size Size passed to the target's deallocate (>= min_size, < 4 GiB)
+         * @param alignment Alignment passed to the target's deallocate
+         * @note Complexity: O(1), wait-free - never blocks, allocates or calls the target.
+         */
+        void push(void* ptr, const std::size_t size, const std::size_t alignment = alignof(std::max_align_t)) noexcept
+        {
+            if (!ptr)
+            {
+                return;
+            }
+
+            assert(size >= min_size && "Deferred allocation too small to hold a queue node");
+            assert(size <= UINT32_MAX && alignment <= UINT32_MAX && "Deferred allocation too large");
+
+            Node* node = new (ptr) Node{{nullptr}, static_cast<std::uint32_t>(size),
+                                        static_cast<std::uint32_t>(alignment)};
+            pushed_.fetch_add(1, std::memory_order_relaxed);
+            link(node);
+        }
+
+        /**
+         * @brief Deallocate up to @p max_count queued allocations on the calling thread.
+         *
+         * @return Number of allocations freed
+         * @note A push() that is still in progress is picked up by the next drain().
+         */
+        std::size_t drain(std::size_t max_count = SIZE_MAX);
+
+        /**
+         * @brief Start a background thread that calls drain() every @p interval.
+         * @note The worker sleeps between batches; producers never wake it.
+         */
+        void start_worker(std::chrono::microseconds interval = std::chrono::milliseconds(1));
+
+        /** @brief Stop the background thread, if running, after a final drain(). */
+        void stop_worker();
+
+        /** @brief Check whether the background thread is running. */
+        [[nodiscard]] bool worker_running() const noexcept { return worker_.joinable(); }
+
+        /** @brief Get the number of allocations pushed but not yet freed (approximate while in use). */
+        [[nodiscard]] std::size_t pending() const noexcept
+        {
+            return pushed_.load(std::memory_order_relaxed) - freed_.load(std::memory_order_relaxed);
+        }
+
+        /** @brief Get the handle of the allocator frees are forwarded to. */
+        [[nodiscard]] const AllocatorHandle& target() const noexcept { return target_; }
+
+    private:
+        AllocatorHandle target_;
+
+        // Producer cache line
+        alignas(64) std::atomic<Node*> head_; ///< Most recently pushed node
+        std::atomic<std::size_t> pushed_{0};
+
+        // Consumer cache line
+        alignas(64) Node* tail_; ///< Oldest node not yet consumed
+        Node stub_;              ///< Keeps the list non-empty between drains
+        std::atomic<std::size_t> freed_{0};
+
+        std::mutex consumer_mutex_; ///< Serialises drain()
+        std::mutex worker_mutex_;
+        std::condition_variable worker_wake_;
+        bool stop_requested_ = false;
+        std::thread worker_;
+
+        /** @brief Append @p node to the list. Wait-free. */
+        void link(Node* node) noexcept
+        {
+            Node* previous = head_.exchange(node, std::memory_order_acq_rel);
+            previous->next.store(node, std::memory_order_release);
+        }
+
+        /** @brief Unlink the oldest node, or nullptr if none is fully linked. Consumer only. */
+        Node* pop() noexcept;
+    };
+} // namespace fast_alloc
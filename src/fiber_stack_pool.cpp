@@ -0,0 +1,216 @@
+#include "fiber_stack_pool.h"
+
+#include <cassert>
+#include <utility>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace fast_alloc
+{
+    FiberStackPool::FiberStackPool(const std::size_t stack_size, const std::size_t stack_count,
+                                   const std::size_t warm_watermark)
+        : page_size_(system_page_size())
+          , stack_size_((stack_size + page_size_ - 1) & ~(page_size_ - 1))
+          , slot_size_(stack_size_ + page_size_)
+          , stack_count_(stack_count)
+          , allocated_count_(0)
+          , warm_watermark_(warm_watermark)
+          , memory_(nullptr)
+    {
+        assert(stack_size > 0 && "Stack size must be greater than zero");
+        assert(stack_count > 0 && "Stack count must be greater than zero");
+        assert(stack_count <= UINT32_MAX && "Stack count must fit in 32 bits");
+
+        const std::size_t bytes = slot_size_ * stack_count_;
+
+#ifdef _WIN32
+        // Reserve only - stacks are committed on first use, guard pages never are
+        memory_ = VirtualAlloc(nullptr, bytes, MEM_RESERVE, PAGE_NOACCESS);
+        assert(memory_ && "Failed to reserve stack memory");
+#else
+        int flags = MAP_PRIVATE | MAP_ANONYMOUS;
+#ifdef MAP_NORESERVE
+        flags |= MAP_NORESERVE;
+#endif
+        void* region = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, flags, -1, 0);
+        assert(region != MAP_FAILED && "Failed to reserve stack memory");
+        memory_ = region == MAP_FAILED ? nullptr : region;
+
+        // One-off cost: make every guard page inaccessible. Each call splits the mapping, so this
+        // can fail with ENOMEM at vm.max_map_count; never hand out stacks without their guard.
+        for (std::size_t i = 0; memory_ && i < stack_count_; ++i)
+        {
+            if (mprotect(static_cast<std::byte*>(memory_) + i * slot_size_, page_size_, PROT_NONE) != 0)
+            {
+                assert(false && "Failed to protect guard page");
+                release();
+            }
+        }
+#endif
+
+        if (!memory_)
+        {
+            return; // Invalid pool: allocate() always returns nullptr
+        }
+
+        // Everything starts cold; lowest stack on top
+        cold_free_.reserve(stack_count_);
+        for (std::size_t i = stack_count_; i > 0; --i)
+        {
+            cold_free_.push_back(static_cast<std::uint32_t>(i - 1));
+        }
+        warm_free_.reserve(stack_count_);
+    }
+
+    FiberStackPool::~FiberStackPool()
+    {
+        release();
+    }
+
+    FiberStackPool::FiberStackPool(FiberStackPool&& other) noexcept
+        : page_size_(other.page_size_)
+          , stack_size_(other.stack_size_)
+          , slot_size_(other.slot_size_)
+          , stack_count_(other.stack_count_)
+          , allocated_count_(other.allocated_count_)
+          , warm_watermark_(other.warm_watermark_)
+          , memory_(other.memory_)
+          , warm_free_(std::move(other.warm_free_))
+          , cold_free_(std::move(other.cold_free_))
+    {
+        other.memory_ = nullptr;
+        other.allocated_count_ = 0;
+        other.warm_free_.clear();
+        other.cold_free_.clear();
+    }
+
+    FiberStackPool& FiberStackPool::operator=(FiberStackPool&& other) noexcept
+    {
+        if (this != &other)
+        {
+            release();
+
+            page_size_ = other.page_size_;
+            stack_size_ = other.stack_size_;
+            slot_size_ = other.slot_size_;
+            stack_count_ = other.stack_count_;
+            allocated_count_ = other.allocated_count_;
+            warm_watermark_ = other.warm_watermark_;
+            memory_ = other.memory_;
+            warm_free_ = std::move(other.warm_free_);
+            cold_free_ = std::move(other.cold_free_);
+
+            other.memory_ = nullptr;
+            other.allocated_count_ = 0;
+            other.warm_free_.clear();
+            other.cold_free_.clear();
+        }
+        return *this;
+    }
+
+    void* FiberStackPool::allocate()
+    {
+        if (!warm_free_.empty())
+        {
+            const std::uint32_t index = warm_free_.back();
+            warm_free_.pop_back();
+            ++allocated_count_;
+            return stack_at(index);
+        }
+
+        if (cold_free_.empty())
+        {
+            return nullptr; // Pool exhausted
+        }
+
+        const std::uint32_t index = cold_free_.back();
+        std::byte* stack = stack_at(index);
+
+#ifdef _WIN32
+        if (!VirtualAlloc(stack, stack_size_, MEM_COMMIT, PAGE_READWRITE))
+        {
+            return nullptr; // Out of commit charge
+        }
+#endif
+        // POSIX: untouched or MADV_DONTNEED pages fault in as zero pages on demand
+
+        cold_free_.pop_back();
+        ++allocated_count_;
+        return stack;
+    }
+
+    void FiberStackPool::deallocate(void* stack)
+    {
+        if (!stack)
+        {
+            return;
+        }
+
+        assert(allocated_count_ > 0 && "Deallocating from empty pool");
+
+        // Validate pointer is the base of one of our stacks
+        const auto stack_address = reinterpret_cast<std::size_t>(stack);
+        const auto memory_start = reinterpret_cast<std::size_t>(memory_);
+
+        assert(stack_address >= memory_start + page_size_
+            && stack_address < memory_start + slot_size_ * stack_count_
+            && "Pointer outside stack pool range");
+        assert((stack_address - memory_start) % slot_size_ == page_size_
+            && "Pointer is not a stack base");
+
+        const auto index = static_cast<std::uint32_t>((stack_address - memory_start) / slot_size_);
+        --allocated_count_;
+
+        if (warm_free_.size() < warm_watermark_)
+        {
+            warm_free_.push_back(index);
+            return;
+        }
+
+        // Above the watermark - hand the pages back to the OS but keep the address range
+#ifdef _WIN32
+        VirtualFree(stack, stack_size_, MEM_DECOMMIT);
+#else
+        madvise(stack, stack_size_, MADV_DONTNEED);
+#endif
+        cold_free_.push_back(index);
+    }
+
+    std::byte* FiberStackPool::stack_at(const std::size_t index) const noexcept
+    {
+        return static_cast<std::byte*>(memory_) + index * slot_size_ + page_size_;
+    }
+
+    void FiberStackPool::release() noexcept
+    {
+        if (!memory_)
+        {
+            return;
+        }
+
+#ifdef _WIN32
+        VirtualFree(memory_, 0, MEM_RELEASE);
+#else
+        munmap(memory_, slot_size_ * stack_count_);
+#endif
+        memory_ = nullptr;
+    }
+
+    std::size_t FiberStackPool::system_page_size() noexcept
+    {
+#ifdef _WIN32
+        SYSTEM_INFO info;
+        GetSystemInfo(&info);
+        return info.dwPageSize;
+#else
+        return static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+#endif
+    }
+} // namespace fast_alloc
@@ -0,0 +1,124 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace fast_alloc
+{
+    /**
+     * @brief Pool of fixed-size fiber/coroutine stacks with guard pages.
+     *
+     * Reserves one virtual memory region up front and carves it into slots of
+     * [guard page | stack]. Each guard page is inaccessible, so a stack overflow faults instead
+     * of silently corrupting the neighbouring stack. Acquiring a stack is a free-list pop - no
+     * mmap, mprotect or fresh page faults on the hot path once a stack has been used.
+     *
+     * Released stacks stay committed (warm) up to a watermark; beyond it they are decommitted
+     * (MADV_DONTNEED on POSIX, MEM_DECOMMIT on Windows) so idle stacks do not pin memory.
+     * Warm stacks are always reused before cold ones.
+     *
+     * Ideal for: fiber schedulers, stackful coroutines, green threads.
+     *
+     * @note Thread-safety: Not thread-safe.
+     * @note Memory overhead: One guard page per stack (address space only, never committed).
+     *       On POSIX each guard page also splits the mapping, costing two kernel VMAs per stack;
+     *       very large pools can hit vm.max_map_count (65530 by default on Linux).
+     * @note Stacks grow down: start a fiber at top(stack), not at the returned pointer.
+     */
+    class FiberStackPool
+    {
+    public:
+        static constexpr std::size_t keep_all = SIZE_MAX; ///< Watermark that never decommits
+
+        /**
+         * @brief Construct a fiber stack pool.
+         *
+         * @param stack_size Usable bytes per stack (rounded up to the page size)
+         * @param stack_count Number of stacks to reserve
+         * @param warm_watermark Released stacks kept committed before further releases are decommitted
+         * @throws assert if stack_size == 0, stack_count == 0 or the reservation fails
+         * @note If the reservation or a guard page fails in a release build, the pool is left
+         *       invalid (see valid()) and allocate() returns nullptr; stacks are never handed out
+         *       unguarded.
+         */
+        FiberStackPool(std::size_t stack_size, std::size_t stack_count, std::size_t warm_watermark = keep_all);
+        ~FiberStackPool();
+
+        // Disable copy
+        FiberStackPool(const FiberStackPool&) = delete;
+        FiberStackPool& operator=(const FiberStackPool&) = delete;
+
+        // Enable move
+        FiberStackPool(FiberStackPool&& other) noexcept;
+        FiberStackPool& operator=(FiberStackPool&& other) noexcept;
+
+        /**
+         * @brief Acquire a stack.
+         *
+         * @return Lowest usable address of the stack (just above its guard page),
+         *         or nullptr if every stack is in use.
+         * @note Complexity: O(1) - pops a warm stack, or a cold one (recommitting it on Windows)
+         */
+        void* allocate();
+
+        /**
+         * @brief Release a stack back to the pool.
+         *
+         * @param stack Pointer from allocate(). nullptr is safely ignored.
+         * @note Complexity: O(1), plus one decommit system call above the watermark
+         * @warning Passing invalid pointers will trigger assertions in debug builds.
+         */
+        void deallocate(void* stack);
+
+        /** @brief Get the initial stack pointer (highest address) for a stack from allocate(). */
+        [[nodiscard]] void* top(void* stack) const noexcept
+        {
+            return static_cast<std::byte*>(stack) + stack_size_;
+        }
+
+        /** @brief Check whether the pool holds its reservation (false if construction failed or moved from). */
+        [[nodiscard]] bool valid() const noexcept { return memory_ != nullptr; }
+
+        /** @brief Get the usable size of each stack in bytes. */
+        [[nodiscard]] std::size_t stack_size() const noexcept { return stack_size_; }
+
+        /** @brief Get the size of the guard region below each stack in bytes. */
+        [[nodiscard]] std::size_t guard_size() const noexcept { return page_size_; }
+
+        /** @brief Get the total number of stacks. */
+        [[nodiscard]] std::size_t capacity() const noexcept { return stack_count_; }
+
+        /** @brief Get the number of stacks in use. */
+        [[nodiscard]] std::size_t allocated() const noexcept { return allocated_count_; }
+
+        /** @brief Get the number of released stacks still committed. */
+        [[nodiscard]] std::size_t warm() const noexcept { return warm_free_.size(); }
+
+        /** @brief Get the warm stack watermark. */
+        [[nodiscard]] std::size_t warm_watermark() const noexcept { return warm_watermark_; }
+
+        /** @brief Change the warm stack watermark. Takes effect on later releases. */
+        void set_warm_watermark(std::size_t watermark) noexcept { warm_watermark_ = watermark; }
+
+    private:
+        std::size_t page_size_;
+        std::size_t stack_size_;
+        std::size_t slot_size_;  ///< Guard page plus stack
+        std::size_t stack_count_;
+        std::size_t allocated_count_;
+        std::size_t warm_watermark_;
+        void* memory_;           ///< Base of the reservation
+        std::vector<std::uint32_t> warm_free_; ///< Released stacks that are still committed
+        std::vector<std::uint32_t> cold_free_; ///< Never used or decommitted stacks
+
+        /** @brief Get the usable base address of stack @p index. */
+        [[nodiscard]] std::byte* stack_at(std::size_t index) const noexcept;
+
+        /** @brief Release the whole reservation. */
+        void release() noexcept;
+
+        /** @brief Query the system page size. */
+        [[nodiscard]] static std::size_t system_page_size() noexcept;
+    };
+} // namespace fast_alloc
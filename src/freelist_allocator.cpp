@@ -1,6 +1,9 @@
 #include "freelist_allocator.h"
+#include "reclaim_registry.h"
 
+#include <algorithm>
 #include <cassert>
+#include <utility>
 
 #ifdef _WIN32
 #include <malloc.h>
@@ -17,6 +20,10 @@ namespace fast_alloc
           , strategy_(strategy)
           , memory_(nullptr)
           , free_blocks_(nullptr)
+          , reclaim_registry_(nullptr)
+          , quick_lists_{}
+          , deferred_count_(0)
+          , deferred_threshold_(0)
     {
         assert(size > sizeof(FreeBlock) && "Size must be larger than FreeBlock");
 
@@ -52,9 +59,15 @@ namespace fast_alloc
           , strategy_(other.strategy_)
           , memory_(other.memory_)
           , free_blocks_(other.free_blocks_)
+          , reclaim_registry_(other.reclaim_registry_)
+          , quick_lists_(other.quick_lists_)
+          , deferred_count_(other.deferred_count_)
+          , deferred_threshold_(other.deferred_threshold_)
     {
         other.memory_ = nullptr;
         other.free_blocks_ = nullptr;
+        other.quick_lists_.fill(nullptr);
+        other.deferred_count_ = 0;
         other.size_ = 0;
         other.used_memory_ = 0;
         other.num_allocations_ = 0;
@@ -79,9 +92,15 @@ namespace fast_alloc
             strategy_ = other.strategy_;
             memory_ = other.memory_;
             free_blocks_ = other.free_blocks_;
+            reclaim_registry_ = other.reclaim_registry_;
+            quick_lists_ = other.quick_lists_;
+            deferred_count_ = other.deferred_count_;
+            deferred_threshold_ = other.deferred_threshold_;
 
             other.memory_ = nullptr;
             other.free_blocks_ = nullptr;
+            other.quick_lists_.fill(nullptr);
+            other.deferred_count_ = 0;
             other.size_ = 0;
             other.used_memory_ = 0;
             other.num_allocations_ = 0;
@@ -94,6 +113,14 @@ namespace fast_alloc
         assert(size > 0 && "Allocation size must be greater than zero");
         assert(memory_ && "Allocator not initialised");
 
+        if (deferred_count_ > 0)
+        {
+            if (void* ptr = allocate_deferred(size, alignment))
+            {
+                return ptr;
+            }
+        }
+
         FreeBlock* prev_block = nullptr;
         FreeBlock* current_block = free_blocks_;
         FreeBlock* best_block = nullptr;
@@ -140,7 +167,13 @@ namespace fast_alloc
 
         if (!best_block)
         {
-            return nullptr; // No suitable block found
+            if (deferred_count_ > 0)
+            {
+                // Deferred blocks may coalesce into one that fits
+                flush_deferred();
+                return allocate(size, alignment);
+            }
+            return allocate_after_reclaim(size, alignment); // No suitable block found
         }
 
         // Calculate adjustment again for the selected block
@@ -198,6 +231,74 @@ namespace fast_alloc
         return reinterpret_cast<void*>(aligned_address);
     }
 
+    void* FreeListAllocator::allocate_after_reclaim(const std::size_t size, const std::size_t alignment)
+    {
+        if (!reclaim_registry_)
+        {
+            return nullptr;
+        }
+
+        // Detach the registry so callbacks allocating from here, and the retry, don't reclaim again
+        ReclaimRegistry* registry = std::exchange(reclaim_registry_, nullptr);
+        void* ptr = registry->reclaim(size + sizeof(AllocationHeader)) > 0 ? allocate(size, alignment) : nullptr;
+        reclaim_registry_ = registry;
+
+        return ptr;
+    }
+
+    void* FreeListAllocator::allocate_deferred(const std::size_t size, const std::size_t alignment) noexcept
+    {
+        // A block fits if it covers the header and padding for its own address: check the head of
+        // each quick list whose sizes fall between the best and worst case
+        const std::size_t min_size = size + sizeof(AllocationHeader);
+        const std::size_t max_size = min_size + alignment - 1;
+        if (min_size > quick_list_max_size)
+        {
+            return nullptr;
+        }
+
+        const std::size_t last = std::min(max_size / quick_list_granularity, quick_list_count - 1);
+        for (std::size_t index = min_size / quick_list_granularity; index <= last; ++index)
+        {
+            FreeBlock* block = quick_lists_[index];
+            if (!block)
+            {
+                continue;
+            }
+
+            std::size_t adjustment = 0;
+            const std::size_t aligned_address = align_forward_with_header(
+                reinterpret_cast<std::size_t>(block),
+                alignment,
+                sizeof(AllocationHeader),
+                adjustment
+            );
+
+            if (block->size < size + adjustment)
+            {
+                continue;
+            }
+
+            quick_lists_[index] = block->next;
+            --deferred_count_;
+
+            // Hand out the whole block so it returns to the same quick list
+            const std::size_t block_size = block->size;
+            auto* header = reinterpret_cast<AllocationHeader*>(
+                aligned_address - sizeof(AllocationHeader)
+            );
+            header->size = block_size;
+            header->adjustment = adjustment;
+
+            used_memory_ += block_size;
+            ++num_allocations_;
+
+            return reinterpret_cast<void*>(aligned_address);
+        }
+
+        return nullptr;
+    }
+
     void FreeListAllocator::deallocate(void* ptr)
     {
         if (!ptr)
@@ -217,6 +318,24 @@ namespace fast_alloc
         const std::size_t block_start = block_address - header->adjustment;
         const std::size_t block_size = header->size;
 
+        if (deferred_threshold_ > 0 && block_size <= quick_list_max_size)
+        {
+            // Park the block on its quick list; coalescence waits for flush_deferred()
+            auto* block = reinterpret_cast<FreeBlock*>(block_start);
+            block->size = block_size;
+            block->next = quick_lists_[block_size / quick_list_granularity];
+            quick_lists_[block_size / quick_list_granularity] = block;
+
+            used_memory_ -= block_size;
+            --num_allocations_;
+
+            if (++deferred_count_ >= deferred_threshold_)
+            {
+                flush_deferred();
+            }
+            return;
+        }
+
         // Create new free block
         auto* new_block = reinterpret_cast<FreeBlock*>(block_start);
         new_block->size = block_size;
@@ -254,6 +373,111 @@ namespace fast_alloc
         --num_allocations_;
     }
 
+    void FreeListAllocator::set_deferred_coalescing(const std::size_t threshold)
+    {
+        deferred_threshold_ = threshold;
+        if (threshold == 0 || deferred_count_ >= threshold)
+        {
+            flush_deferred();
+        }
+    }
+
+    void FreeListAllocator::flush_deferred() noexcept
+    {
+        if (deferred_count_ == 0)
+        {
+            return;
+        }
+
+        // Gather every quick list into one chain
+        FreeBlock* chain = nullptr;
+        for (FreeBlock*& head : quick_lists_)
+        {
+            while (head)
+            {
+                FreeBlock* block = head;
+                head = head->next;
+                block->next = chain;
+                chain = block;
+            }
+        }
+        deferred_count_ = 0;
+
+        // One pass merging the sorted chain into the free list, coalescing as it goes
+        FreeBlock* prev_block = nullptr;
+        FreeBlock* current_block = free_blocks_;
+        chain = sort_by_address(chain);
+
+        while (chain)
+        {
+            FreeBlock* block = chain;
+            chain = chain->next;
+
+            while (current_block && reinterpret_cast<std::size_t>(current_block) < reinterpret_cast<std::size_t>(block))
+            {
+                prev_block = current_block;
+                current_block = current_block->next;
+            }
+
+            if (prev_block)
+            {
+                prev_block->next = block;
+            }
+            else
+            {
+                free_blocks_ = block;
+            }
+            block->next = current_block;
+
+            coalescence(prev_block, block);
+
+            // Unless it was absorbed by its predecessor, the block now precedes the rest
+            if (!prev_block || prev_block->next == block)
+            {
+                prev_block = block;
+            }
+            current_block = prev_block->next;
+        }
+    }
+
+    FreeListAllocator::FreeBlock* FreeListAllocator::sort_by_address(FreeBlock* list) noexcept
+    {
+        if (!list || !list->next)
+        {
+            return list;
+        }
+
+        // Split in half
+        FreeBlock* slow = list;
+        FreeBlock* fast = list->next;
+        while (fast && fast->next)
+        {
+            slow = slow->next;
+            fast = fast->next->next;
+        }
+        FreeBlock* second = slow->next;
+        slow->next = nullptr;
+
+        FreeBlock* first = sort_by_address(list);
+        second = sort_by_address(second);
+
+        // Merge
+        FreeBlock head{0, nullptr};
+        FreeBlock* tail = &head;
+        while (first && second)
+        {
+            FreeBlock*& lower = reinterpret_cast<std::size_t>(first) < reinterpret_cast<std::size_t>(second)
+                                    ? first
+                                    : second;
+            tail->next = lower;
+            tail = lower;
+            lower = lower->next;
+        }
+        tail->next = first ? first : second;
+
+        return head.next;
+    }
+
     void FreeListAllocator::coalescence(FreeBlock* previous, FreeBlock* current)
     {
         // Coalescence merges adjacent free blocks to reduce fragmentation.
@@ -1,10 +1,13 @@
 #pragma once
 
+#include <array>
 #include <cstddef>
 #include <cstdint>
 
 namespace fast_alloc
 {
+    class ReclaimRegistry;
+
     /**
      * @brief Allocation strategy for free list allocator.
      */
@@ -27,7 +30,8 @@ namespace fast_alloc
      * @note Thread-safety: Not thread-safe.
      * @note Memory overhead: 16 bytes per allocation (AllocationHeader).
      * @note Fragmentation: Mitigated by automatic coalescence.
-     * @note Performance: O(n) allocation/deallocation (searches free list).
+     * @note Performance: O(n) allocation/deallocation (searches free list). With deferred
+     *       coalescing enabled, small blocks freed and reallocated at the same size are O(1).
      * 
      * @warning Not suitable for real-time systems requiring deterministic timing.
      */
@@ -58,7 +62,8 @@ namespace fast_alloc
          * @param size Number of bytes to allocate (must be > 0)
          * @param alignment Memory alignment requirement (default: alignof(std::max_align_t))
          * @return Pointer to allocated memory, or nullptr if no suitable block found
-         * @note Complexity: O(n) where n is number of free blocks
+         * @note Complexity: O(n) where n is number of free blocks; O(1) when a deferred block of
+         *       the right size is available
          * 
          * The allocator will search the free list using the configured strategy:
          * - FirstFit: Returns first block large enough (faster)
@@ -69,10 +74,11 @@ namespace fast_alloc
         /**
          * @brief Deallocate memory block.
          * 
-         * Automatically coalesces with adjacent free blocks to reduce fragmentation.
+         * Automatically coalesces with adjacent free blocks to reduce fragmentation. With deferred
+         * coalescing enabled, small blocks are instead parked on a per-size quick list.
          * 
          * @param ptr Pointer to memory (must be from this allocator). nullptr is safely ignored.
-         * @note Complexity: O(n) where n is number of free blocks
+         * @note Complexity: O(n) where n is number of free blocks; O(1) when deferred
          */
         void deallocate(void* ptr);
 
@@ -88,6 +94,45 @@ namespace fast_alloc
         /** @brief Get number of active allocations. */
         [[nodiscard]] std::size_t num_allocations() const noexcept { return num_allocations_; }
 
+        /**
+         * @brief Run @p registry's callbacks when no free block fits, then retry once.
+         *
+         * @param registry Registry to consult (must outlive the allocator), or nullptr to disable (default)
+         * @note Callbacks may deallocate() into this allocator; allocations they make never reclaim again.
+         */
+        void set_reclaim_registry(ReclaimRegistry* registry) noexcept { reclaim_registry_ = registry; }
+
+        /** @brief Get the reclaim registry, or nullptr if none is set. */
+        [[nodiscard]] ReclaimRegistry* reclaim_registry() const noexcept { return reclaim_registry_; }
+
+        static constexpr std::size_t quick_list_granularity = 16; ///< Block size step between quick lists
+        static constexpr std::size_t quick_list_max_size = 512;   ///< Largest block (with header) deferred
+
+        /**
+         * @brief Defer coalescing of small freed blocks (dlmalloc "fastbins").
+         *
+         * deallocate() pushes blocks of up to quick_list_max_size bytes onto a quick list for
+         * their size without touching the free list, and allocate() pops a fitting block from
+         * those lists before searching. Deferred blocks are merged back into the free list, with
+         * coalescence, once @p threshold of them are pending or an allocation finds no free block.
+         *
+         * @param threshold Deferred blocks allowed before merging, or 0 to disable (default: disabled)
+         * @note Disabling, or lowering the threshold below the pending count, merges immediately.
+         */
+        void set_deferred_coalescing(std::size_t threshold = 64);
+
+        /** @brief Get the deferred block threshold, or 0 if deferred coalescing is disabled. */
+        [[nodiscard]] std::size_t deferred_threshold() const noexcept { return deferred_threshold_; }
+
+        /** @brief Get the number of freed blocks waiting on quick lists. */
+        [[nodiscard]] std::size_t deferred_blocks() const noexcept { return deferred_count_; }
+
+        /**
+         * @brief Merge every deferred block into the free list now.
+         * @note Complexity: O(k log k + n) for k deferred and n free blocks.
+         */
+        void flush_deferred() noexcept;
+
     private:
         /**
          * @brief Header stored before each allocation.
@@ -115,6 +160,23 @@ namespace fast_alloc
         FreeListStrategy strategy_;
         void* memory_;
         FreeBlock* free_blocks_; ///< Head of free list (sorted by address for coalescence)
+        ReclaimRegistry* reclaim_registry_; ///< Consulted before allocate() gives up
+
+        static constexpr std::size_t quick_list_count = quick_list_max_size / quick_list_granularity + 1;
+
+        /// Deferred blocks, indexed by size / quick_list_granularity (unsorted, never coalesced)
+        std::array<FreeBlock*, quick_list_count> quick_lists_;
+        std::size_t deferred_count_;     ///< Blocks currently on quick lists
+        std::size_t deferred_threshold_; ///< Merge once this many are pending; 0 disables deferral
+
+        /** @brief Slow path of allocate(): reclaim, then retry once with the registry detached. */
+        void* allocate_after_reclaim(std::size_t size, std::size_t alignment);
+
+        /** @brief Take a whole block from the quick lists that fits, or nullptr if none does. */
+        void* allocate_deferred(std::size_t size, std::size_t alignment) noexcept;
+
+        /** @brief Sort a chain of free blocks by address (merge sort). */
+        static FreeBlock* sort_by_address(FreeBlock* list) noexcept;
 
         /**
          * @brief Merge adjacent free blocks.
@@ -0,0 +1,228 @@
+#pragma once
+
+#include "stack_allocator.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace fast_alloc
+{
+    /**
+     * @brief Linear allocator whose first N bytes live inside the object, spilling to the heap.
+     *
+     * Declared as a local variable, the arena's buffer sits on the call stack: constructing it
+     * costs nothing and allocations that fit in N bytes never touch the heap. Only when the
+     * buffer is exhausted does it chain to heap chunks (StackAllocators of spill_chunk_size()
+     * bytes, or larger for oversized requests), which are kept for reuse after reset() until
+     * the arena is destroyed or shrink() is called.
+     *
+     * Markers work as with StackAllocator, across the inline buffer and every chunk.
+     *
+     * Example:
+     * @code
+     * void build_path(const Node& node)
+     * {
+     *     InlineArena<1024> scratch;   // No heap allocation
+     *     auto* segments = static_cast<Segment*>(scratch.allocate(depth * sizeof(Segment), alignof(Segment)));
+     *     // ... deep trees spill to the heap transparently ...
+     * }                                // Everything released here
+     * @endcode
+     *
+     * @tparam N Bytes of inline storage (aligned to alignof(std::max_align_t))
+     * @note Thread-safety: Not thread-safe.
+     * @note Memory overhead: 0 bytes per allocation.
+     * @warning Pinned: allocations point into the object itself, so it cannot be copied or moved.
+     *          Keep N modest for arenas on the stack of threads with small stacks.
+     */
+    template <std::size_t N>
+    class InlineArena
+    {
+        static_assert(N > 0, "Inline capacity must be greater than zero");
+
+    public:
+        static constexpr std::size_t inline_capacity = N;                  ///< Bytes stored in the object
+        static constexpr std::size_t default_spill_chunk_size = 16 * 1024; ///< Default heap chunk size
+
+        /**
+         * @brief Position to rewind to with reset().
+         */
+        struct Marker
+        {
+            std::size_t region; ///< 0 for the inline buffer, i for the i-th heap chunk
+            void* position;     ///< Top of that region
+        };
+
+        /**
+         * @brief Construct an empty arena. Allocates nothing.
+         * @param spill_chunk_size Size in bytes of each heap chunk used on overflow (must be > 0)
+         */
+        explicit InlineArena(const std::size_t spill_chunk_size = default_spill_chunk_size) noexcept
+            : top_(buffer_)
+              , region_(0)
+              , spill_chunk_size_(spill_chunk_size)
+        {
+            assert(spill_chunk_size > 0 && "Spill chunk size must be greater than zero");
+        }
+
+        // Pinned: allocations point into buffer_
+        InlineArena(const InlineArena&) = delete;
+        InlineArena& operator=(const InlineArena&) = delete;
+
+        /**
+         * @brief Allocate memory, from the inline buffer while it has room.
+         *
+         * @param size Number of bytes to allocate
+         * @param alignment Memory alignment requirement (power of 2, default: alignof(std::max_align_t))
+         * @return Pointer to allocated memory (nullptr only if the heap is exhausted)
+         * @note Complexity: O(1) - pointer bump; grows by one heap chunk when full
+         */
+        void* allocate(const std::size_t size, const std::size_t alignment = alignof(std::max_align_t))
+        {
+            assert((alignment & (alignment - 1)) == 0 && "Alignment must be power of 2");
+
+            if (region_ == 0)
+            {
+                const auto base = reinterpret_cast<std::uintptr_t>(buffer_);
+                const std::uintptr_t aligned =
+                    (reinterpret_cast<std::uintptr_t>(top_) + alignment - 1) & ~(alignment - 1);
+                const std::size_t offset = aligned - base;
+                if (offset <= N && size <= N - offset)
+                {
+                    top_ = buffer_ + offset + size;
+                    return buffer_ + offset;
+                }
+            }
+            else if (void* ptr = spill_[region_ - 1].allocate(size, alignment))
+            {
+                return ptr;
+            }
+
+            return allocate_spill(size, alignment);
+        }
+
+        /**
+         * @brief Resize the most recent allocation in place (see StackAllocator::try_grow).
+         * @return true if the allocation now spans new_size bytes; false leaves it unchanged
+         */
+        bool try_grow(void* ptr, const std::size_t old_size, const std::size_t new_size) noexcept
+        {
+            if (region_ > 0)
+            {
+                return spill_[region_ - 1].try_grow(ptr, old_size, new_size);
+            }
+
+            auto* const start = static_cast<std::byte*>(ptr);
+            if (!ptr || start + old_size != top_ || static_cast<std::size_t>(start - buffer_) + new_size > N)
+            {
+                return false;
+            }
+
+            top_ = start + new_size;
+            return true;
+        }
+
+        /**
+         * @brief Get the current position for a later reset().
+         * @note Use with reset() to implement scoped memory allocation
+         */
+        [[nodiscard]] Marker get_marker() const noexcept
+        {
+            return {region_, region_ == 0 ? static_cast<void*>(top_) : spill_[region_ - 1].get_marker()};
+        }
+
+        /**
+         * @brief Rewind to @p marker, releasing everything allocated after it.
+         * @note Heap chunks are kept for reuse.
+         */
+        void reset(const Marker marker)
+        {
+            assert(marker.region <= region_ && "Marker is ahead of the arena");
+
+            for (std::size_t i = marker.region + 1; i <= region_; ++i)
+            {
+                spill_[i - 1].reset();
+            }
+
+            if (marker.region == 0)
+            {
+                assert(marker.position >= buffer_ && marker.position <= buffer_ + N && "Invalid marker");
+                top_ = static_cast<std::byte*>(marker.position);
+            }
+            else
+            {
+                spill_[marker.region - 1].reset(marker.position);
+            }
+            region_ = marker.region;
+        }
+
+        /** @brief Release every allocation. Heap chunks are kept for reuse. */
+        void reset() { reset(Marker{0, buffer_}); }
+
+        /** @brief Free heap chunks holding no allocations. */
+        void shrink()
+        {
+            while (spill_.size() > region_)
+            {
+                spill_.pop_back();
+            }
+        }
+
+        /** @brief Get the bytes allocated, including alignment padding and skipped chunk tails. */
+        [[nodiscard]] std::size_t used() const noexcept
+        {
+            std::size_t total = static_cast<std::size_t>(top_ - buffer_);
+            for (std::size_t i = 0; i < region_; ++i)
+            {
+                total += spill_[i].used();
+            }
+            return total;
+        }
+
+        /** @brief Check whether allocations currently extend into heap chunks. */
+        [[nodiscard]] bool spilled() const noexcept { return region_ > 0; }
+
+        /** @brief Get the number of heap chunks held (in use or kept for reuse). */
+        [[nodiscard]] std::size_t spill_chunk_count() const noexcept { return spill_.size(); }
+
+        /** @brief Get the size of each heap chunk in bytes. */
+        [[nodiscard]] std::size_t spill_chunk_size() const noexcept { return spill_chunk_size_; }
+
+        /** @brief Check whether @p ptr points into the inline buffer. */
+        [[nodiscard]] bool is_inline(const void* ptr) const noexcept
+        {
+            const auto* byte = static_cast<const std::byte*>(ptr);
+            return byte >= buffer_ && byte < buffer_ + N;
+        }
+
+    private:
+        alignas(std::max_align_t) std::byte buffer_[N];
+        std::byte* top_;     ///< Inline bump pointer (kept while spilled, for used() and markers)
+        std::size_t region_; ///< Region being bumped: 0 inline, i for spill_[i - 1]
+        std::size_t spill_chunk_size_;
+        std::vector<StackAllocator> spill_; ///< Heap chunks in fill order
+
+        /** @brief Slow path of allocate(): move to the next heap chunk, adding one if needed. */
+        void* allocate_spill(const std::size_t size, const std::size_t alignment)
+        {
+            // Chunks left over from before a reset()
+            while (region_ < spill_.size())
+            {
+                if (void* ptr = spill_[region_++].allocate(size, alignment))
+                {
+                    return ptr;
+                }
+            }
+
+            // Grow: oversized requests get a chunk of their own
+            spill_.emplace_back(std::max(spill_chunk_size_, size + alignment));
+            region_ = spill_.size();
+
+            void* ptr = spill_.back().allocate(size, alignment);
+            assert(ptr && "Fresh chunk too small for allocation");
+            return ptr;
+        }
+    };
+} // namespace fast_alloc
@@ -0,0 +1,130 @@
+#include "job_arena_allocator.h"
+
+#include <algorithm>
+#include <cassert>
+#include <utility>
+
+namespace fast_alloc
+{
+    JobArenaAllocator::JobArenaAllocator(const std::size_t worker_count, const std::size_t chunk_size,
+                                         const std::size_t max_graphs)
+        : worker_count_(worker_count)
+          , chunk_size_(chunk_size)
+          , slots_(max_graphs)
+    {
+        assert(worker_count > 0 && "Worker count must be greater than zero");
+        assert(chunk_size > 0 && "Chunk size must be greater than zero");
+        assert(max_graphs > 0 && "Max graphs must be greater than zero");
+
+        for (GraphSlot& slot : slots_)
+        {
+            slot.workers.resize(worker_count_);
+        }
+    }
+
+    JobGraph JobArenaAllocator::begin_graph() noexcept
+    {
+        for (std::size_t i = 0; i < slots_.size(); ++i)
+        {
+            if (GraphSlot& slot = slots_[i]; !slot.active)
+            {
+                slot.active = true;
+                return {static_cast<std::uint32_t>(i), slot.generation};
+            }
+        }
+
+        return {UINT32_MAX, 0}; // Every slot in flight
+    }
+
+    void* JobArenaAllocator::allocate(const JobGraph graph, const std::size_t worker, const std::size_t size,
+                                      const std::size_t alignment)
+    {
+        assert(worker < worker_count_ && "Worker index out of range");
+
+        WorkerArena& arena = slot_of(graph).workers[worker];
+
+        if (arena.current < arena.chunks.size())
+        {
+            if (void* ptr = arena.chunks[arena.current].allocate(size, alignment))
+            {
+                return ptr;
+            }
+
+            // Move on to a chunk left over from an earlier graph, if any
+            while (++arena.current < arena.chunks.size())
+            {
+                if (void* ptr = arena.chunks[arena.current].allocate(size, alignment))
+                {
+                    return ptr;
+                }
+            }
+        }
+
+        // Grow: oversized requests get a chunk of their own
+        const std::size_t bytes = std::max(chunk_size_, size + alignment);
+        arena.chunks.emplace_back(bytes);
+        arena.current = arena.chunks.size() - 1;
+
+        void* ptr = arena.chunks.back().allocate(size, alignment);
+        assert(ptr && "Fresh chunk too small for allocation");
+        return ptr;
+    }
+
+    void JobArenaAllocator::end_graph(const JobGraph graph) noexcept
+    {
+        GraphSlot& slot = slot_of(graph);
+
+        for (WorkerArena& arena : slot.workers)
+        {
+            for (std::size_t i = 0; i < arena.chunks.size() && i <= arena.current; ++i)
+            {
+                arena.chunks[i].reset();
+            }
+            arena.current = 0;
+        }
+
+        slot.active = false;
+        ++slot.generation;
+    }
+
+    std::size_t JobArenaAllocator::used(const JobGraph graph) const noexcept
+    {
+        std::size_t total = 0;
+        for (const WorkerArena& arena : slot_of(graph).workers)
+        {
+            for (const StackAllocator& chunk : arena.chunks)
+            {
+                total += chunk.used();
+            }
+        }
+        return total;
+    }
+
+    std::size_t JobArenaAllocator::chunk_count() const noexcept
+    {
+        std::size_t total = 0;
+        for (const GraphSlot& slot : slots_)
+        {
+            for (const WorkerArena& arena : slot.workers)
+            {
+                total += arena.chunks.size();
+            }
+        }
+        return total;
+    }
+
+    const JobArenaAllocator::GraphSlot& JobArenaAllocator::slot_of(const JobGraph graph) const noexcept
+    {
+        assert(graph.slot < slots_.size() && "Invalid job graph");
+
+        const GraphSlot& slot = slots_[graph.slot];
+        assert(slot.active && slot.generation == graph.generation && "Job graph already ended");
+
+        return slot;
+    }
+
+    JobArenaAllocator::GraphSlot& JobArenaAllocator::slot_of(const JobGraph graph) noexcept
+    {
+        return const_cast<GraphSlot&>(std::as_const(*this).slot_of(graph));
+    }
+} // namespace fast_alloc
@@ -0,0 +1,439 @@
+#pragma once
+
+#include "threadsafe_pool_allocator.h"
+
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace fast_alloc
+{
+    namespace detail
+    {
+        /**
+         * @brief Node index paired with a modification tag in one atomic word.
+         *
+         * The low half is the node's index plus one (0 is null); the high half counts writes, so
+         * a compare-exchange against a value read before the node was recycled always fails.
+         * This prevents ABA without hazard pointers or epochs.
+         */
+        using TaggedRef = std::uint64_t;
+
+        [[nodiscard]] constexpr std::uint32_t ref_of(const TaggedRef tagged) noexcept
+        {
+            return static_cast<std::uint32_t>(tagged);
+        }
+
+        [[nodiscard]] constexpr std::uint32_t tag_of(const TaggedRef tagged) noexcept
+        {
+            return static_cast<std::uint32_t>(tagged >> 32);
+        }
+
+        [[nodiscard]] constexpr TaggedRef make_tagged(const std::uint32_t ref, const std::uint32_t tag) noexcept
+        {
+            return static_cast<TaggedRef>(tag) << 32 | ref;
+        }
+
+        /**
+         * @brief Cache-line nodes drawn from a ThreadSafePoolAllocator and recycled lock-free.
+         *
+         * Released nodes go onto a Treiber free list of tagged indices rather than back to the
+         * pool, so steady-state acquire/release never takes the pool's mutex; the pool is only
+         * locked to hand out a block that has never been used. Node memory stays mapped and
+         * typed as Node until the owner is destroyed, so a thread still reading a node another
+         * thread has recycled reads a valid atomic and fails its tagged compare-exchange.
+         *
+         * @tparam Node Node type with a `std::atomic<TaggedRef> next` member
+         */
+        template <typename Node>
+        class LockFreeNodePool
+        {
+        public:
+            explicit LockFreeNodePool(const std::size_t capacity)
+                : pool_(sizeof(Node), capacity, alignof(Node))
+                  , memory_(static_cast<std::byte*>(pool_.data()))
+                  , stride_(pool_.block_stride())
+                  , free_(0)
+            {
+                assert(capacity < UINT32_MAX && "Node indices are 32-bit");
+            }
+
+            LockFreeNodePool(const LockFreeNodePool&) = delete;
+            LockFreeNodePool& operator=(const LockFreeNodePool&) = delete;
+
+            /** @brief Take a node, or return 0 if every node is in use. */
+            [[nodiscard]] std::uint32_t acquire() noexcept
+            {
+                TaggedRef head = free_.load(std::memory_order_acquire);
+                while (ref_of(head) != 0)
+                {
+                    // May read a node another thread just took; the tag then fails the exchange
+                    const TaggedRef next = node(ref_of(head)).next.load(std::memory_order_relaxed);
+                    if (free_.compare_exchange_weak(head, make_tagged(ref_of(next), tag_of(head) + 1),
+                                                    std::memory_order_acquire, std::memory_order_acquire))
+                    {
+                        return ref_of(head);
+                    }
+                }
+
+                // Free list empty: draw a block the pool has never handed out
+                void* block = pool_.allocate();
+                if (!block)
+                {
+                    return 0;
+                }
+                new (block) Node{};
+                return static_cast<std::uint32_t>((static_cast<std::byte*>(block) - memory_) / stride_) + 1;
+            }
+
+            /** @brief Put a node the caller owns back on the free list. */
+            void release(const std::uint32_t ref) noexcept
+            {
+                Node& released = node(ref);
+                TaggedRef head = free_.load(std::memory_order_relaxed);
+                do
+                {
+                    link(released, ref_of(head));
+                }
+                while (!free_.compare_exchange_weak(head, make_tagged(ref, tag_of(head) + 1),
+                                                    std::memory_order_release, std::memory_order_relaxed));
+            }
+
+            [[nodiscard]] Node& node(const std::uint32_t ref) const noexcept
+            {
+                return *std::launder(reinterpret_cast<Node*>(memory_ + (ref - 1) * stride_));
+            }
+
+            [[nodiscard]] std::size_t capacity() const noexcept { return pool_.capacity(); }
+
+            /**
+             * @brief Point an owned node's next at @p ref, advancing its tag.
+             * @note Tags on next only ever increase, so stale readers of a recycled node never match.
+             */
+            static void link(Node& owned, const std::uint32_t ref) noexcept
+            {
+                const TaggedRef previous = owned.next.load(std::memory_order_relaxed);
+                owned.next.store(make_tagged(ref, tag_of(previous) + 1), std::memory_order_relaxed);
+            }
+
+        private:
+            ThreadSafePoolAllocator pool_;
+            std::byte* memory_;
+            std::size_t stride_;
+            alignas(64) std::atomic<TaggedRef> free_; ///< Head of the recycled-node list
+        };
+    } // namespace detail
+
+    /**
+     * @brief Bounded lock-free LIFO stack (Treiber) with pool-backed, recycled nodes.
+     *
+     * Each element lives in its own cache-line-aligned node, so threads pushing and popping
+     * neighbouring elements never false share. Nodes come from an internal ThreadSafePoolAllocator
+     * of @p capacity blocks and are recycled through a lock-free free list: after the first
+     * @p capacity pushes, push and pop never allocate or lock.
+     *
+     * Example:
+     * @code
+     * LockFreeStack<Job*> idle_jobs(1024);
+     * idle_jobs.try_push(job);        // Any thread
+     * Job* next = nullptr;
+     * if (idle_jobs.try_pop(next)) { run(next); }
+     * @endcode
+     *
+     * @note Thread-safety: try_push() and try_pop() may be called from any number of threads.
+     * @note Reclamation: nodes are never returned to the OS while the stack lives, and every head
+     *       update carries a tag, so a stale pop cannot succeed (no ABA, no use-after-free).
+     */
+    template <typename T>
+    class LockFreeStack
+    {
+    public:
+        using value_type = T;
+
+        /** @brief Create an empty stack holding at most @p capacity elements. */
+        explicit LockFreeStack(const std::size_t capacity)
+            : nodes_(capacity)
+              , head_(0)
+        {
+        }
+
+        /** @brief Destroy every element still on the stack. No push or pop may be in flight. */
+        ~LockFreeStack()
+        {
+            for (std::uint32_t ref = detail::ref_of(head_.load(std::memory_order_acquire)); ref != 0;
+                 ref = detail::ref_of(nodes_.node(ref).next.load(std::memory_order_relaxed)))
+            {
+                std::launder(reinterpret_cast<T*>(nodes_.node(ref).storage))->~T();
+            }
+        }
+
+        // Pinned: other threads hold references
+        LockFreeStack(const LockFreeStack&) = delete;
+        LockFreeStack& operator=(const LockFreeStack&) = delete;
+
+        /**
+         * @brief Push @p value.
+         *
+         * @return false if all capacity() nodes are in use (the value is left untouched)
+         * @note Lock-free; takes the pool's mutex only while nodes are first being drawn from it
+         */
+        bool try_push(T value)
+        {
+            const std::uint32_t ref = nodes_.acquire();
+            if (ref == 0)
+            {
+                return false;
+            }
+
+            Node& node = nodes_.node(ref);
+            new (node.storage) T(std::move(value));
+
+            detail::TaggedRef head = head_.load(std::memory_order_relaxed);
+            do
+            {
+                Nodes::link(node, detail::ref_of(head));
+            }
+            while (!head_.compare_exchange_weak(head, detail::make_tagged(ref, detail::tag_of(head) + 1),
+                                                std::memory_order_release, std::memory_order_relaxed));
+            return true;
+        }
+
+        /**
+         * @brief Pop the most recently pushed element into @p out.
+         * @return false if the stack is empty
+         */
+        bool try_pop(T& out)
+        {
+            detail::TaggedRef head = head_.load(std::memory_order_acquire);
+            while (detail::ref_of(head) != 0)
+            {
+                const detail::TaggedRef next = nodes_.node(detail::ref_of(head)).next.load(std::memory_order_relaxed);
+                if (head_.compare_exchange_weak(head, detail::make_tagged(detail::ref_of(next), detail::tag_of(head) + 1),
+                                                std::memory_order_acquire, std::memory_order_acquire))
+                {
+                    // Exclusively ours now
+                    T* value = std::launder(reinterpret_cast<T*>(nodes_.node(detail::ref_of(head)).storage));
+                    out = std::move(*value);
+                    value->~T();
+                    nodes_.release(detail::ref_of(head));
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        /** @brief Check whether the stack is empty (a snapshot while other threads are active). */
+        [[nodiscard]] bool empty() const noexcept
+        {
+            return detail::ref_of(head_.load(std::memory_order_acquire)) == 0;
+        }
+
+        [[nodiscard]] std::size_t capacity() const noexcept { return nodes_.capacity(); }
+
+    private:
+        struct alignas(64) Node
+        {
+            std::atomic<detail::TaggedRef> next;
+            alignas(T) std::byte storage[sizeof(T)];
+        };
+
+        using Nodes = detail::LockFreeNodePool<Node>;
+
+        Nodes nodes_;
+        alignas(64) std::atomic<detail::TaggedRef> head_;
+    };
+
+    /**
+     * @brief Bounded lock-free MPMC FIFO queue (Michael-Scott) with pool-backed, recycled nodes.
+     *
+     * The classic linked queue with a dummy head node, using tagged indices instead of counted
+     * pointers. Nodes are cache-line aligned, come from an internal ThreadSafePoolAllocator and
+     * are recycled through a lock-free free list, so after warm-up enqueue and dequeue never
+     * allocate or lock. Head and tail live on separate cache lines.
+     *
+     * A dequeuer copies the value out before its exchange on head proves the node was still
+     * queued, and may race with a recycler writing that node; values are therefore stored as
+     * relaxed atomic words, and T must be trivially copyable (pointers, handles, small records).
+     *
+     * Example:
+     * @code
+     * LockFreeQueue<Message> mailbox(4096);
+     * mailbox.try_push(message);     // Any producer
+     * Message received;
+     * while (mailbox.try_pop(received)) { handle(received); }   // Any consumer
+     * @endcode
+     *
+     * @note Thread-safety: try_push() and try_pop() may be called from any number of threads.
+     * @note Reclamation: nodes stay mapped and typed for the queue's lifetime and every head,
+     *       tail and next update carries a tag, so stale exchanges fail instead of corrupting it.
+     */
+    template <typename T>
+    class LockFreeQueue
+    {
+        static_assert(std::is_trivially_copyable_v<T>,
+                      "LockFreeQueue copies values word by word while nodes may be recycled");
+
+    public:
+        using value_type = T;
+
+        /** @brief Create an empty queue holding at most @p capacity elements. */
+        explicit LockFreeQueue(const std::size_t capacity)
+            : nodes_(capacity + 1) // Plus the dummy
+        {
+            const std::uint32_t dummy = nodes_.acquire();
+            head_.store(detail::make_tagged(dummy, 0), std::memory_order_relaxed);
+            tail_.store(detail::make_tagged(dummy, 0), std::memory_order_relaxed);
+        }
+
+        // Pinned: other threads hold references
+        LockFreeQueue(const LockFreeQueue&) = delete;
+        LockFreeQueue& operator=(const LockFreeQueue&) = delete;
+
+        /**
+         * @brief Append @p value.
+         *
+         * @return false if all capacity() nodes are in use
+         * @note Lock-free; takes the pool's mutex only while nodes are first being drawn from it
+         */
+        bool try_push(const T& value) noexcept
+        {
+            const std::uint32_t ref = nodes_.acquire();
+            if (ref == 0)
+            {
+                return false;
+            }
+
+            Node& node = nodes_.node(ref);
+            node.store(value);
+            Nodes::link(node, 0);
+
+            detail::TaggedRef tail;
+            while (true)
+            {
+                tail = tail_.load(std::memory_order_acquire);
+                Node& last = nodes_.node(detail::ref_of(tail));
+                detail::TaggedRef next = last.next.load(std::memory_order_acquire);
+
+                if (tail != tail_.load(std::memory_order_acquire))
+                {
+                    continue;
+                }
+
+                if (detail::ref_of(next) == 0)
+                {
+                    if (last.next.compare_exchange_weak(next, detail::make_tagged(ref, detail::tag_of(next) + 1),
+                                                        std::memory_order_release, std::memory_order_relaxed))
+                    {
+                        break;
+                    }
+                }
+                else
+                {
+                    // Tail is lagging: help swing it forward
+                    tail_.compare_exchange_weak(tail, detail::make_tagged(detail::ref_of(next), detail::tag_of(tail) + 1),
+                                                std::memory_order_release, std::memory_order_relaxed);
+                }
+            }
+
+            tail_.compare_exchange_strong(tail, detail::make_tagged(ref, detail::tag_of(tail) + 1),
+                                          std::memory_order_release, std::memory_order_relaxed);
+            return true;
+        }
+
+        /**
+         * @brief Remove the oldest element into @p out.
+         * @return false if the queue is empty
+         */
+        bool try_pop(T& out) noexcept
+        {
+            while (true)
+            {
+                detail::TaggedRef head = head_.load(std::memory_order_acquire);
+                const detail::TaggedRef tail = tail_.load(std::memory_order_acquire);
+                const detail::TaggedRef next = nodes_.node(detail::ref_of(head)).next.load(std::memory_order_acquire);
+
+                if (head != head_.load(std::memory_order_acquire))
+                {
+                    continue;
+                }
+
+                if (detail::ref_of(head) == detail::ref_of(tail))
+                {
+                    if (detail::ref_of(next) == 0)
+                    {
+                        return false;
+                    }
+                    // Tail is lagging: help swing it forward
+                    detail::TaggedRef expected = tail;
+                    tail_.compare_exchange_weak(expected, detail::make_tagged(detail::ref_of(next), detail::tag_of(tail) + 1),
+                                                std::memory_order_release, std::memory_order_relaxed);
+                    continue;
+                }
+
+                // Read before the exchange: once head moves, next becomes the dummy and may be recycled
+                const T value = nodes_.node(detail::ref_of(next)).load();
+                if (head_.compare_exchange_weak(head, detail::make_tagged(detail::ref_of(next), detail::tag_of(head) + 1),
+                                                std::memory_order_acq_rel, std::memory_order_relaxed))
+                {
+                    out = value;
+                    nodes_.release(detail::ref_of(head)); // The old dummy
+                    return true;
+                }
+            }
+        }
+
+        /** @brief Check whether the queue is empty (a snapshot while other threads are active). */
+        [[nodiscard]] bool empty() const noexcept
+        {
+            const detail::TaggedRef head = head_.load(std::memory_order_acquire);
+            return detail::ref_of(nodes_.node(detail::ref_of(head)).next.load(std::memory_order_acquire)) == 0;
+        }
+
+        [[nodiscard]] std::size_t capacity() const noexcept { return nodes_.capacity() - 1; }
+
+    private:
+        static constexpr std::size_t value_words = (sizeof(T) + sizeof(std::uint64_t) - 1) / sizeof(std::uint64_t);
+
+        struct alignas(64) Node
+        {
+            std::atomic<detail::TaggedRef> next;
+            std::array<std::atomic<std::uint64_t>, value_words> words;
+
+            void store(const T& value) noexcept
+            {
+                std::uint64_t buffer[value_words] = {};
+                std::memcpy(buffer, &value, sizeof(T));
+                for (std::size_t i = 0; i < value_words; ++i)
+                {
+                    words[i].store(buffer[i], std::memory_order_relaxed);
+                }
+            }
+
+            [[nodiscard]] T load() const noexcept
+            {
+                std::uint64_t buffer[value_words];
+                for (std::size_t i = 0; i < value_words; ++i)
+                {
+                    buffer[i] = words[i].load(std::memory_order_relaxed);
+                }
+                // Bytes first, so T need not be default-constructible
+                std::array<std::byte, sizeof(T)> bytes;
+                std::memcpy(bytes.data(), buffer, sizeof(T));
+                return std::bit_cast<T>(bytes);
+            }
+        };
+
+        using Nodes = detail::LockFreeNodePool<Node>;
+
+        Nodes nodes_;
+        alignas(64) std::atomic<detail::TaggedRef> head_; ///< Dummy node; the next node holds the oldest value
+        alignas(64) std::atomic<detail::TaggedRef> tail_; ///< Last node, or lagging by one
+    };
+} // namespace fast_alloc
@@ -0,0 +1,384 @@
+#pragma once
+
+#include "pool_allocator.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <new>
+#include <utility>
+
+namespace fast_alloc
+{
+    /**
+     * @brief Fixed-capacity least-recently-used cache whose entries live in pool blocks.
+     *
+     * Each entry is one pool block holding the key, the value and the links of an intrusive
+     * recency list. Lookups go through an open-addressing index of entry pointers (linear
+     * probing, at most half full, backward-shift erase). Both the pool and the index are sized
+     * once in the constructor: when the pool is exhausted, insert_or_assign() evicts the least
+     * recently used entry and constructs the new one in its block, so an insertion never fails
+     * and never allocates.
+     *
+     * Compared with the usual std::unordered_map + std::list pairing, a hit costs one hash, a
+     * short probe and four pointer writes, and a miss with eviction touches no allocator at all.
+     *
+     * Example:
+     * @code
+     * LruPool<std::uint64_t, Glyph> glyphs(4096);
+     * if (Glyph* glyph = glyphs.find(codepoint)) { return *glyph; }
+     * return glyphs.insert_or_assign(codepoint, rasterise(codepoint));
+     * @endcode
+     *
+     * @note Thread-safety: Not thread-safe (find() reorders the recency list).
+     * @warning Pointers and references to values are invalidated when their entry is evicted or erased.
+     */
+    template <typename K, typename V, typename Hash = std::hash<K>, typename Equal = std::equal_to<K>,
+              typename Config = PoolConfig>
+    class LruPool
+    {
+    public:
+        using key_type = K;
+        using mapped_type = V;
+
+        /**
+         * @brief Create an empty cache.
+         *
+         * @param capacity Maximum number of entries (must be > 0)
+         * @throws assert if capacity == 0
+         */
+        explicit LruPool(const std::size_t capacity)
+            : pool_(sizeof(Entry), capacity, std::max(alignof(Entry), alignof(void*)))
+              , index_(nullptr)
+              , index_mask_(0)
+              , head_(nullptr)
+              , tail_(nullptr)
+              , size_(0)
+              , evictions_(0)
+        {
+            assert(capacity > 0 && "Capacity must be greater than zero");
+
+            // Keep the index at most half full so probe runs stay short
+            std::size_t slots = 16;
+            while (slots < capacity * 2)
+            {
+                slots *= 2;
+            }
+            index_ = std::make_unique<Entry*[]>(slots);
+            index_mask_ = slots - 1;
+        }
+
+        ~LruPool() { clear(); }
+
+        // Disable copy
+        LruPool(const LruPool&) = delete;
+        LruPool& operator=(const LruPool&) = delete;
+
+        // Enable move
+        LruPool(LruPool&& other) noexcept
+            : pool_(std::move(other.pool_))
+              , index_(std::move(other.index_))
+              , index_mask_(other.index_mask_)
+              , head_(other.head_)
+              , tail_(other.tail_)
+              , size_(other.size_)
+              , evictions_(other.evictions_)
+        {
+            other.index_mask_ = 0;
+            other.head_ = nullptr;
+            other.tail_ = nullptr;
+            other.size_ = 0;
+            other.evictions_ = 0;
+        }
+
+        LruPool& operator=(LruPool&& other) noexcept
+        {
+            if (this != &other)
+            {
+                clear();
+
+                pool_ = std::move(other.pool_);
+                index_ = std::move(other.index_);
+                index_mask_ = other.index_mask_;
+                head_ = other.head_;
+                tail_ = other.tail_;
+                size_ = other.size_;
+                evictions_ = other.evictions_;
+
+                other.index_mask_ = 0;
+                other.head_ = nullptr;
+                other.tail_ = nullptr;
+                other.size_ = 0;
+                other.evictions_ = 0;
+            }
+            return *this;
+        }
+
+        /**
+         * @brief Look up @p key and mark it most recently used.
+         *
+         * @return The cached value, or nullptr on a miss
+         * @note Complexity: O(1) average
+         */
+        [[nodiscard]] V* find(const K& key) noexcept
+        {
+            Entry* entry = lookup(key, Hash{}(key));
+            if (!entry)
+            {
+                return nullptr;
+            }
+
+            touch(entry);
+            return &entry->value;
+        }
+
+        /** @brief Look up @p key without changing its recency; nullptr on a miss. */
+        [[nodiscard]] const V* peek(const K& key) const noexcept
+        {
+            const Entry* entry = lookup(key, Hash{}(key));
+            return entry ? &entry->value : nullptr;
+        }
+
+        [[nodiscard]] bool contains(const K& key) const noexcept { return peek(key) != nullptr; }
+
+        /**
+         * @brief Store @p value for @p key and mark it most recently used.
+         *
+         * Overwrites the value if @p key is cached. Otherwise, when the cache is full, the least
+         * recently used entry is destroyed and the new entry is built in its block.
+         *
+         * @return The stored value
+         * @note Complexity: O(1) average; never allocates
+         * @note If copying the key or moving the value throws, the exception propagates and the
+         *       cache keeps its capacity, but an entry evicted to make room stays evicted.
+         */
+        V& insert_or_assign(const K& key, V value)
+        {
+            const std::size_t hash = Hash{}(key);
+            if (Entry* entry = lookup(key, hash))
+            {
+                entry->value = std::move(value);
+                touch(entry);
+                return entry->value;
+            }
+
+            void* block = pool_.allocate();
+            if (!block)
+            {
+                // Full: recycle the least recently used entry's block
+                Entry* victim = tail_;
+                unlink(victim);
+                unindex(victim);
+                victim->~Entry();
+                --size_;
+                ++evictions_;
+                block = victim;
+            }
+
+            Entry* entry;
+            try
+            {
+                entry = new (block) Entry{key, std::move(value), hash, nullptr, nullptr};
+            }
+            catch (...)
+            {
+                // Keep the block: a throwing key copy or value move must not shrink the cache
+                pool_.deallocate(block);
+                throw;
+            }
+            index(entry);
+            push_front(entry);
+            ++size_;
+
+            return entry->value;
+        }
+
+        /**
+         * @brief Remove @p key and return its block to the pool.
+         * @return true if it was cached
+         */
+        bool erase(const K& key) noexcept
+        {
+            Entry* entry = lookup(key, Hash{}(key));
+            if (!entry)
+            {
+                return false;
+            }
+
+            unlink(entry);
+            unindex(entry);
+            entry->~Entry();
+            pool_.deallocate(entry);
+            --size_;
+            return true;
+        }
+
+        /** @brief Remove every entry, returning their blocks to the pool. */
+        void clear() noexcept
+        {
+            for (Entry* entry = head_; entry;)
+            {
+                Entry* next = entry->next;
+                entry->~Entry();
+                pool_.deallocate(entry);
+                entry = next;
+            }
+
+            if (index_)
+            {
+                std::fill_n(index_.get(), index_mask_ + 1, nullptr);
+            }
+
+            head_ = nullptr;
+            tail_ = nullptr;
+            size_ = 0;
+        }
+
+        /** @brief Call @p visit(key, value) for every entry, most recently used first. */
+        template <typename Visitor>
+        void for_each(Visitor&& visit)
+        {
+            for (Entry* entry = head_; entry; entry = entry->next)
+            {
+                visit(static_cast<const K&>(entry->key), entry->value);
+            }
+        }
+
+        /** @brief Get the key that the next eviction would remove; the cache must not be empty. */
+        [[nodiscard]] const K& least_recent() const noexcept
+        {
+            assert(tail_ && "Cache is empty");
+            return tail_->key;
+        }
+
+        [[nodiscard]] std::size_t size() const noexcept { return size_; }
+        [[nodiscard]] bool empty() const noexcept { return size_ == 0; }
+        [[nodiscard]] bool full() const noexcept { return size_ == capacity(); }
+
+        /** @brief Get the maximum number of entries. */
+        [[nodiscard]] std::size_t capacity() const noexcept { return pool_.capacity(); }
+
+        /** @brief Get the number of entries evicted to make room since construction. */
+        [[nodiscard]] std::size_t evictions() const noexcept { return evictions_; }
+
+    private:
+        /**
+         * @brief One cache entry, occupying one pool block.
+         */
+        struct Entry
+        {
+            K key;
+            V value;
+            std::size_t hash; ///< Cached so probing and erase never rehash keys
+            Entry* prev;      ///< More recently used neighbour
+            Entry* next;      ///< Less recently used neighbour
+        };
+
+        BasicPoolAllocator<Config> pool_;
+        std::unique_ptr<Entry*[]> index_; ///< Open-addressing slots; nullptr is empty
+        std::size_t index_mask_;
+        Entry* head_; ///< Most recently used
+        Entry* tail_; ///< Least recently used, evicted first
+        std::size_t size_;
+        std::size_t evictions_;
+
+        [[nodiscard]] Entry* lookup(const K& key, const std::size_t hash) const noexcept
+        {
+            for (std::size_t slot = hash & index_mask_; index_[slot]; slot = (slot + 1) & index_mask_)
+            {
+                Entry* entry = index_[slot];
+                if (entry->hash == hash && Equal{}(entry->key, key))
+                {
+                    return entry;
+                }
+            }
+            return nullptr;
+        }
+
+        /** @brief Slot currently holding @p entry, which must be indexed. */
+        [[nodiscard]] std::size_t slot_of(const Entry* entry) const noexcept
+        {
+            std::size_t slot = entry->hash & index_mask_;
+            while (index_[slot] != entry)
+            {
+                slot = (slot + 1) & index_mask_;
+            }
+            return slot;
+        }
+
+        void index(Entry* entry) noexcept
+        {
+            std::size_t slot = entry->hash & index_mask_;
+            while (index_[slot])
+            {
+                slot = (slot + 1) & index_mask_;
+            }
+            index_[slot] = entry;
+        }
+
+        /** @brief Remove @p entry from the index, shifting later entries of its probe run back. */
+        void unindex(const Entry* entry) noexcept
+        {
+            std::size_t hole = slot_of(entry);
+            for (std::size_t next = (hole + 1) & index_mask_; index_[next]; next = (next + 1) & index_mask_)
+            {
+                // Move an entry back only if the hole lies on its probe path
+                const std::size_t home = index_[next]->hash & index_mask_;
+                if (((next - home) & index_mask_) >= ((next - hole) & index_mask_))
+                {
+                    index_[hole] = index_[next];
+                    hole = next;
+                }
+            }
+            index_[hole] = nullptr;
+        }
+
+        void push_front(Entry* entry) noexcept
+        {
+            entry->prev = nullptr;
+            entry->next = head_;
+            if (head_)
+            {
+                head_->prev = entry;
+            }
+            else
+            {
+                tail_ = entry;
+            }
+            head_ = entry;
+        }
+
+        void unlink(const Entry* entry) noexcept
+        {
+            if (entry->prev)
+            {
+                entry->prev->next = entry->next;
+            }
+            else
+            {
+                head_ = entry->next;
+            }
+
+            if (entry->next)
+            {
+                entry->next->prev = entry->prev;
+            }
+            else
+            {
+                tail_ = entry->prev;
+            }
+        }
+
+        /** @brief Move @p entry to the front of the recency list. */
+        void touch(Entry* entry) noexcept
+        {
+            if (entry != head_)
+            {
+                unlink(entry);
+                push_front(entry);
+            }
+        }
+    };
+} // namespace fast_alloc
@@ -0,0 +1,183 @@
+#include "memory_budget.h"
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+
+namespace fast_alloc
+{
+    MemoryBudget::MemoryBudget(std::string name, MemoryBudget* parent, const std::size_t soft_limit,
+                               const std::size_t hard_limit)
+        : name_(std::move(name))
+          , parent_(parent)
+          , soft_limit_(soft_limit)
+          , hard_limit_(hard_limit)
+    {
+        if (parent_)
+        {
+            std::lock_guard lock(parent_->children_mutex_);
+            parent_->children_.push_back(this);
+        }
+    }
+
+    MemoryBudget::~MemoryBudget()
+    {
+        assert(children_.empty() && "Budget destroyed before its children");
+
+        if (parent_)
+        {
+            // Whatever this node propagated no longer counts against the ancestors
+            if (const std::int64_t propagated = committed_.load(std::memory_order_relaxed); propagated != 0)
+            {
+                parent_->propagate(-propagated);
+            }
+
+            std::lock_guard lock(parent_->children_mutex_);
+            auto& siblings = parent_->children_;
+            siblings.erase(std::find(siblings.begin(), siblings.end(), this));
+        }
+    }
+
+    bool MemoryBudget::try_charge(const std::size_t bytes) noexcept
+    {
+        const auto request = static_cast<std::int64_t>(bytes);
+        const std::int64_t local = shards_[thread_slot()].pending.load(std::memory_order_relaxed);
+
+        for (const MemoryBudget* node = this; node; node = node->parent_)
+        {
+            const std::size_t limit = node->hard_limit_.load(std::memory_order_relaxed);
+            if (limit == unlimited)
+            {
+                continue;
+            }
+
+            // This thread's unpropagated bytes count everywhere up the chain
+            const std::int64_t projected = node->committed_.load(std::memory_order_relaxed) + local + request;
+            if (projected > static_cast<std::int64_t>(limit))
+            {
+                node->notify(BudgetEvent::HardLimitExceeded);
+                return false;
+            }
+        }
+
+        charge(bytes);
+        return true;
+    }
+
+    std::size_t MemoryBudget::used() const noexcept
+    {
+        const std::int64_t total = committed_.load(std::memory_order_relaxed) + pending_in_subtree();
+        return total > 0 ? static_cast<std::size_t>(total) : 0;
+    }
+
+    std::vector<const MemoryBudget*> MemoryBudget::children() const
+    {
+        std::lock_guard lock(children_mutex_);
+        return {children_.begin(), children_.end()};
+    }
+
+    void MemoryBudget::propagate(const std::int64_t delta) noexcept
+    {
+        if (delta == 0)
+        {
+            return;
+        }
+
+        for (MemoryBudget* node = this; node; node = node->parent_)
+        {
+            node->commit(delta);
+        }
+    }
+
+    std::int64_t MemoryBudget::pending_in_subtree() const noexcept
+    {
+        std::int64_t total = 0;
+        for (const Shard& shard : shards_)
+        {
+            total += shard.pending.load(std::memory_order_relaxed);
+        }
+
+        std::lock_guard lock(children_mutex_);
+        for (const MemoryBudget* child : children_)
+        {
+            total += child->pending_in_subtree();
+        }
+        return total;
+    }
+
+    void MemoryBudget::commit(const std::int64_t delta) noexcept
+    {
+        const std::int64_t now = committed_.fetch_add(delta, std::memory_order_relaxed) + delta;
+
+        std::int64_t peak = peak_.load(std::memory_order_relaxed);
+        while (now > peak && !peak_.compare_exchange_weak(peak, now, std::memory_order_relaxed))
+        {
+        }
+
+        const std::size_t soft = soft_limit_.load(std::memory_order_relaxed);
+        if (soft == unlimited)
+        {
+            return;
+        }
+
+        // Fire once per upward crossing; re-arm when usage drops back under the limit
+        if (now > static_cast<std::int64_t>(soft))
+        {
+            if (!over_soft_limit_.exchange(true, std::memory_order_relaxed))
+            {
+                notify(BudgetEvent::SoftLimitExceeded);
+            }
+        }
+        else if (over_soft_limit_.load(std::memory_order_relaxed))
+        {
+            over_soft_limit_.store(false, std::memory_order_relaxed);
+        }
+    }
+
+    void MemoryBudget::notify(const BudgetEvent event) const
+    {
+        if (callback_)
+        {
+            callback_(*this, event);
+        }
+    }
+
+    namespace
+    {
+        std::atomic<std::uint64_t> used_slots{0}; ///< Bit set = slot owned by a live thread
+
+        static_assert(MemoryBudget::max_threads == 64, "Slot mask holds one bit per exclusive slot");
+
+        /**
+         * @brief Hands the calling thread's slot back when the thread exits.
+         */
+        struct SlotRelease
+        {
+            std::size_t slot;
+
+            ~SlotRelease()
+            {
+                // Release pairs with the acquire in acquire_slot(), ordering the old owner's
+                // last shard stores before the next owner's loads
+                used_slots.fetch_and(~(std::uint64_t{1} << slot), std::memory_order_release);
+            }
+        };
+    } // namespace
+
+    std::size_t MemoryBudget::acquire_slot() noexcept
+    {
+        std::uint64_t mask = used_slots.load(std::memory_order_relaxed);
+        while (~mask != 0)
+        {
+            const auto slot = static_cast<std::size_t>(std::countr_one(mask));
+            if (used_slots.compare_exchange_weak(mask, mask | (std::uint64_t{1} << slot),
+                                                 std::memory_order_acquire, std::memory_order_relaxed))
+            {
+                thread_local SlotRelease release{slot};
+                return slot;
+            }
+        }
+
+        return max_threads; // Every slot taken - share the overflow shard
+    }
+} // namespace fast_alloc
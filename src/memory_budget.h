@@ -0,0 +1,349 @@
+#pragma once
+
+#include "allocator_concept.h"
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace fast_alloc
+{
+    /**
+     * @brief Limit crossing reported to a MemoryBudget callback.
+     */
+    enum class BudgetEvent
+    {
+        SoftLimitExceeded, ///< Usage rose above the soft limit (fired once per crossing)
+        HardLimitExceeded  ///< A charge would take usage above the hard limit
+    };
+
+    /**
+     * @brief One node in a tree of memory budgets (process -> subsystem -> component).
+     *
+     * Allocators charge the node they belong to; every charge also counts against all ancestors,
+     * so each node reports the usage of its whole subtree. Charges land in the calling thread's
+     * own shard of the node - a plain load and store, no locked instruction - and are only
+     * propagated up the tree and checked against limits once the shard has batched batch_size
+     * bytes, keeping accounting off the allocation hot path. Threads beyond max_threads share
+     * one overflow shard updated atomically.
+     *
+     * Each node may have a soft limit (callback only) and a hard limit (try_charge() refuses and
+     * the callback fires). Because of batching, limits are enforced with a slack of up to
+     * batch_size bytes per thread; used() is always exact.
+     *
+     * Example:
+     * @code
+     * MemoryBudget process("process");
+     * MemoryBudget audio("audio", &process, 32 * 1024 * 1024);
+     * BudgetedAllocator voices(voice_pool, audio);
+     * @endcode
+     *
+     * @note Thread-safety: charge(), release(), try_charge() and the getters are thread-safe. Set limits and callbacks before sharing the node between threads.
+     * @note A node must outlive its children and every allocator charged against it.
+     */
+    class MemoryBudget
+    {
+    public:
+        static constexpr std::size_t unlimited = SIZE_MAX;    ///< No limit
+        static constexpr std::size_t max_threads = 64;        ///< Threads with an exclusive shard per node
+        static constexpr std::int64_t batch_size = 16 * 1024; ///< Bytes a shard batches before propagating
+
+        using Callback = std::function<void(const MemoryBudget& budget, BudgetEvent event)>;
+
+        /**
+         * @brief Create a budget node.
+         *
+         * @param name Name reported for this node
+         * @param parent Parent node, or nullptr for a root
+         * @param soft_limit Usage above which the callback is notified (default: unlimited)
+         * @param hard_limit Usage try_charge() refuses to exceed (default: unlimited)
+         */
+        explicit MemoryBudget(std::string name, MemoryBudget* parent = nullptr,
+                              std::size_t soft_limit = unlimited, std::size_t hard_limit = unlimited);
+
+        /** @brief Flush and return any usage still charged here to the ancestors. */
+        ~MemoryBudget();
+
+        // Pinned: children and allocators hold pointers to the node
+        MemoryBudget(const MemoryBudget&) = delete;
+        MemoryBudget& operator=(const MemoryBudget&) = delete;
+
+        /**
+         * @brief Record @p bytes as used by this node, ignoring the hard limit.
+         * @note Complexity: O(1) - one relaxed add; O(depth) once per batch_size bytes
+         */
+        void charge(std::size_t bytes) noexcept { add(static_cast<std::int64_t>(bytes)); }
+
+        /** @brief Record @p bytes previously charged as freed. */
+        void release(std::size_t bytes) noexcept { add(-static_cast<std::int64_t>(bytes)); }
+
+        /**
+         * @brief Charge @p bytes unless that would exceed a hard limit here or in any ancestor.
+         *
+         * @return false (and the refusing node's callback fires with HardLimitExceeded) if refused
+         * @note Complexity: O(depth) loads, plus charge()
+         */
+        bool try_charge(std::size_t bytes) noexcept;
+
+        /**
+         * @brief Get the bytes used by this node's subtree.
+         * @note Complexity: O(subtree * max_threads) - sums every unpropagated shard; meant for
+         *       reporting, not the hot path.
+         */
+        [[nodiscard]] std::size_t used() const noexcept;
+
+        /** @brief Get the highest propagated usage seen. */
+        [[nodiscard]] std::size_t peak() const noexcept
+        {
+            return static_cast<std::size_t>(peak_.load(std::memory_order_relaxed));
+        }
+
+        /** @brief Set the soft limit (unlimited to disable). */
+        void set_soft_limit(std::size_t limit) noexcept { soft_limit_.store(limit, std::memory_order_relaxed); }
+
+        /** @brief Set the hard limit (unlimited to disable). */
+        void set_hard_limit(std::size_t limit) noexcept { hard_limit_.store(limit, std::memory_order_relaxed); }
+
+        /** @brief Set the function notified of limit crossings. Called on the thread that crossed. */
+        void set_callback(Callback callback) { callback_ = std::move(callback); }
+
+        [[nodiscard]] std::size_t soft_limit() const noexcept { return soft_limit_.load(std::memory_order_relaxed); }
+        [[nodiscard]] std::size_t hard_limit() const noexcept { return hard_limit_.load(std::memory_order_relaxed); }
+        [[nodiscard]] const std::string& name() const noexcept { return name_; }
+        [[nodiscard]] MemoryBudget* parent() const noexcept { return parent_; }
+
+        /** @brief Get a snapshot of the direct children. */
+        [[nodiscard]] std::vector<const MemoryBudget*> children() const;
+
+    private:
+        /**
+         * @brief Bytes charged by one thread (or the overflow threads) and not yet propagated.
+         */
+        struct alignas(64) Shard
+        {
+            std::atomic<std::int64_t> pending{0};
+        };
+
+        std::string name_;
+        MemoryBudget* parent_;
+        std::atomic<std::size_t> soft_limit_;
+        std::atomic<std::size_t> hard_limit_;
+        Callback callback_;
+
+        std::array<Shard, max_threads + 1> shards_; ///< One per thread slot, plus the shared overflow shard
+        std::atomic<std::int64_t> committed_{0}; ///< Propagated usage of the subtree
+        std::atomic<std::int64_t> peak_{0};
+        std::atomic<bool> over_soft_limit_{false};
+
+        mutable std::mutex children_mutex_;
+        std::vector<MemoryBudget*> children_;
+
+        void add(const std::int64_t bytes) noexcept
+        {
+            const std::size_t slot = thread_slot();
+            std::atomic<std::int64_t>& pending = shards_[slot].pending;
+
+            if (slot < max_threads)
+            {
+                // Only this thread writes its shard, so no read-modify-write is needed
+                const std::int64_t value = pending.load(std::memory_order_relaxed) + bytes;
+                if (value >= batch_size || value <= -batch_size)
+                {
+                    pending.store(0, std::memory_order_relaxed);
+                    propagate(value);
+                }
+                else
+                {
+                    pending.store(value, std::memory_order_relaxed);
+                }
+            }
+            else
+            {
+                const std::int64_t value = pending.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+                if (value >= batch_size || value <= -batch_size)
+                {
+                    propagate(pending.exchange(0, std::memory_order_relaxed));
+                }
+            }
+        }
+
+        /** @brief Apply @p delta to this node and every ancestor. */
+        void propagate(std::int64_t delta) noexcept;
+
+        /** @brief Sum of every unpropagated shard in this node's subtree. */
+        [[nodiscard]] std::int64_t pending_in_subtree() const noexcept;
+
+        /** @brief Apply a propagated delta to this node and check its limits. */
+        void commit(std::int64_t delta) noexcept;
+
+        void notify(BudgetEvent event) const;
+
+        static inline thread_local std::size_t thread_slot_ = SIZE_MAX; ///< Calling thread's shard, once assigned
+
+        /** @brief Shard slot of the calling thread; max_threads means the shared overflow shard. */
+        static std::size_t thread_slot() noexcept
+        {
+            if (thread_slot_ == SIZE_MAX)
+            {
+                thread_slot_ = acquire_slot();
+            }
+            return thread_slot_;
+        }
+
+        /** @brief Claim a free slot for the calling thread; released again when the thread exits. */
+        static std::size_t acquire_slot() noexcept;
+    };
+
+    /**
+     * @brief Wraps an allocator so every allocation is charged against a MemoryBudget.
+     *
+     * Works with the allocator shapes in this library: allocate(size, alignment) allocators are
+     * charged the requested size, pools (allocate() + block_size()) a whole block. Allocations
+     * that would break a hard limit return nullptr. For arenas without per-allocation free
+     * (StackAllocator), the charge is released by reset().
+     *
+     * @note Thread-safety: Same as the wrapped allocator. Wrapping a thread-safe pool
+     *       (Config::thread_safe) makes the outstanding-bytes counter a relaxed atomic.
+     */
+    template <Allocator A>
+    class BudgetedAllocator
+    {
+        static constexpr bool thread_safe = requires { requires A::config_type::thread_safe; };
+
+    public:
+        BudgetedAllocator(A& allocator, MemoryBudget& budget) noexcept
+            : allocator_(allocator)
+              , budget_(budget)
+              , outstanding_(0)
+        {
+        }
+
+        /** @brief Release whatever is still charged. */
+        ~BudgetedAllocator()
+        {
+            budget_.release(outstanding());
+        }
+
+        // Disable copy
+        BudgetedAllocator(const BudgetedAllocator&) = delete;
+        BudgetedAllocator& operator=(const BudgetedAllocator&) = delete;
+
+        /** @brief Allocate @p size bytes, or nullptr if over budget or the allocator is exhausted. */
+        void* allocate(const std::size_t size, const std::size_t alignment = alignof(std::max_align_t))
+        {
+            const std::size_t charged = charged_size(size);
+            if (!budget_.try_charge(charged))
+            {
+                return nullptr;
+            }
+
+            void* ptr = fast_alloc::allocate(allocator_, size, alignment);
+
+            if (ptr)
+            {
+                add_outstanding(charged);
+            }
+            else
+            {
+                budget_.release(charged);
+            }
+            return ptr;
+        }
+
+        /**
+         * @brief Free @p ptr and release its charge. @p size must match allocate().
+         * @note A no-op for arenas; their charge is released by reset().
+         */
+        void deallocate(void* ptr, const std::size_t size, const std::size_t alignment = alignof(std::max_align_t))
+        {
+            if (!ptr)
+            {
+                return;
+            }
+
+            if constexpr (!requires(A& a) { a.deallocate(ptr, size, alignment); } &&
+                          !requires(A& a) { a.deallocate(ptr); })
+            {
+                (void)alignment;
+                return; // Arena
+            }
+
+            fast_alloc::deallocate(allocator_, ptr, size, alignment);
+
+            const std::size_t charged = charged_size(size);
+            add_outstanding(0 - charged);
+            budget_.release(charged);
+        }
+
+        /** @brief Reset the wrapped allocator and release everything charged through this wrapper. */
+        void reset()
+            requires requires(A& a) { a.reset(); }
+        {
+            allocator_.reset();
+            if constexpr (thread_safe)
+            {
+                budget_.release(outstanding_.exchange(0, std::memory_order_relaxed));
+            }
+            else
+            {
+                budget_.release(outstanding_);
+                outstanding_ = 0;
+            }
+        }
+
+        /** @brief Get the bytes currently charged through this wrapper. */
+        [[nodiscard]] std::size_t outstanding() const noexcept
+        {
+            if constexpr (thread_safe)
+            {
+                return outstanding_.load(std::memory_order_relaxed);
+            }
+            else
+            {
+                return outstanding_;
+            }
+        }
+
+        [[nodiscard]] A& allocator() const noexcept { return allocator_; }
+        [[nodiscard]] MemoryBudget& budget() const noexcept { return budget_; }
+
+    private:
+        using Counter = std::conditional_t<thread_safe, std::atomic<std::size_t>, std::size_t>;
+
+        A& allocator_;
+        MemoryBudget& budget_;
+        Counter outstanding_;
+
+        /** @brief Add @p delta (wrapping, so 0 - n subtracts) to the outstanding bytes. */
+        void add_outstanding(const std::size_t delta) noexcept
+        {
+            if constexpr (thread_safe)
+            {
+                outstanding_.fetch_add(delta, std::memory_order_relaxed);
+            }
+            else
+            {
+                outstanding_ += delta;
+            }
+        }
+
+        [[nodiscard]] std::size_t charged_size(const std::size_t size) const noexcept
+        {
+            if constexpr (requires(const A& a) { a.block_size(); })
+            {
+                (void)size;
+                return allocator_.block_size();
+            }
+            else
+            {
+                return size;
+            }
+        }
+    };
+} // namespace fast_alloc
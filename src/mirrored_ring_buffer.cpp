@@ -0,0 +1,206 @@
+#include "mirrored_ring_buffer.h"
+
+#include <cassert>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <unistd.h>
+#ifndef __linux__
+#include <atomic>
+#include <cstdio>
+#include <fcntl.h>
+#endif
+#endif
+
+namespace fast_alloc
+{
+    MirroredRingBuffer::MirroredRingBuffer(const std::size_t capacity)
+        : data_(nullptr)
+          , capacity_(0)
+          , mask_(0)
+          , head_(0)
+          , cached_tail_(0)
+          , tail_(0)
+          , cached_head_(0)
+    {
+        assert(capacity > 0 && (capacity & (capacity - 1)) == 0 && "Capacity must be a power of 2");
+
+        // Both are powers of 2, so the rounded capacity is too
+        const std::size_t granularity = mapping_granularity();
+        capacity_ = capacity < granularity ? granularity : capacity;
+        mask_ = capacity_ - 1;
+
+        data_ = map_mirrored();
+        assert(data_ && "Failed to map mirrored ring buffer");
+    }
+
+    MirroredRingBuffer::~MirroredRingBuffer()
+    {
+        if (data_)
+        {
+#ifdef _WIN32
+            UnmapViewOfFile(data_ + capacity_);
+            UnmapViewOfFile(data_);
+#else
+            munmap(data_, capacity_ * 2);
+#endif
+        }
+    }
+
+    void* MirroredRingBuffer::reserve(const std::size_t size) noexcept
+    {
+        const std::uint64_t head = head_.load(std::memory_order_relaxed);
+
+        // Check space against the cached tail first; only re-read the consumer's line when short
+        if (head + size - cached_tail_ > capacity_)
+        {
+            cached_tail_ = tail_.load(std::memory_order_acquire);
+            if (head + size - cached_tail_ > capacity_)
+            {
+                return nullptr;
+            }
+        }
+
+        // The second view makes [head, head + size) contiguous even across the end
+        return data_ + (head & mask_);
+    }
+
+    void MirroredRingBuffer::commit(const std::size_t size) noexcept
+    {
+        const std::uint64_t head = head_.load(std::memory_order_relaxed);
+        assert(head + size - cached_tail_ <= capacity_ && "Committing more than was reserved");
+
+        head_.store(head + size, std::memory_order_release);
+    }
+
+    const void* MirroredRingBuffer::peek(std::size_t* size, const std::size_t min_size) noexcept
+    {
+        assert(size && "Size output is required");
+        assert(min_size > 0 && "Minimum size must be greater than zero");
+
+        const std::uint64_t tail = tail_.load(std::memory_order_relaxed);
+        if (cached_head_ - tail < min_size)
+        {
+            cached_head_ = head_.load(std::memory_order_acquire);
+            if (cached_head_ - tail < min_size)
+            {
+                *size = static_cast<std::size_t>(cached_head_ - tail);
+                return nullptr;
+            }
+        }
+
+        *size = static_cast<std::size_t>(cached_head_ - tail);
+        return data_ + (tail & mask_);
+    }
+
+    void MirroredRingBuffer::consume(const std::size_t size) noexcept
+    {
+        const std::uint64_t tail = tail_.load(std::memory_order_relaxed);
+        assert(size <= cached_head_ - tail && "Consuming more than is readable");
+
+        tail_.store(tail + size, std::memory_order_release);
+    }
+
+    std::byte* MirroredRingBuffer::map_mirrored() const noexcept
+    {
+#ifdef _WIN32
+        const auto bytes = static_cast<unsigned long long>(capacity_);
+        HANDLE section = CreateFileMappingW(INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE,
+                                            static_cast<DWORD>(bytes >> 32), static_cast<DWORD>(bytes), nullptr);
+        if (!section)
+        {
+            return nullptr;
+        }
+
+        // Find a free range twice the size, release it and map both views into it. Another
+        // thread can map into the gap in between, so retry a few times.
+        std::byte* result = nullptr;
+        for (int attempt = 0; attempt < 16 && !result; ++attempt)
+        {
+            void* range = VirtualAlloc(nullptr, capacity_ * 2, MEM_RESERVE, PAGE_NOACCESS);
+            if (!range)
+            {
+                break;
+            }
+            VirtualFree(range, 0, MEM_RELEASE);
+
+            auto* first = static_cast<std::byte*>(
+                MapViewOfFileEx(section, FILE_MAP_ALL_ACCESS, 0, 0, capacity_, range));
+            if (!first)
+            {
+                continue;
+            }
+
+            if (MapViewOfFileEx(section, FILE_MAP_ALL_ACCESS, 0, 0, capacity_, first + capacity_))
+            {
+                result = first;
+            }
+            else
+            {
+                UnmapViewOfFile(first);
+            }
+        }
+
+        CloseHandle(section); // The views keep the section alive
+        return result;
+#else
+#ifdef __linux__
+        const int fd = memfd_create("fast_alloc_ring", MFD_CLOEXEC);
+#else
+        // No memfd: a uniquely named shared-memory object, unlinked as soon as it is open
+        static std::atomic<unsigned> sequence{0};
+        char name[32];
+        std::snprintf(name, sizeof(name), "/fa_ring_%d_%u", static_cast<int>(getpid()),
+                      sequence.fetch_add(1, std::memory_order_relaxed));
+        const int fd = shm_open(name, O_RDWR | O_CREAT | O_EXCL, 0600);
+        if (fd >= 0)
+        {
+            shm_unlink(name);
+        }
+#endif
+        if (fd < 0)
+        {
+            return nullptr;
+        }
+
+        std::byte* result = nullptr;
+        if (ftruncate(fd, static_cast<off_t>(capacity_)) == 0)
+        {
+            // Reserve the whole range first so nothing else can land between the views
+            void* range = mmap(nullptr, capacity_ * 2, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if (range != MAP_FAILED)
+            {
+                auto* first = static_cast<std::byte*>(range);
+                if (mmap(first, capacity_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0) != MAP_FAILED &&
+                    mmap(first + capacity_, capacity_, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0) !=
+                    MAP_FAILED)
+                {
+                    result = first;
+                }
+                else
+                {
+                    munmap(range, capacity_ * 2);
+                }
+            }
+        }
+
+        close(fd); // The mappings keep the pages alive
+        return result;
+#endif
+    }
+
+    std::size_t MirroredRingBuffer::mapping_granularity() noexcept
+    {
+#ifdef _WIN32
+        SYSTEM_INFO info;
+        GetSystemInfo(&info);
+        return info.dwAllocationGranularity;
+#else
+        return static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+#endif
+    }
+} // namespace fast_alloc
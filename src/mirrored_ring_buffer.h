@@ -0,0 +1,119 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace fast_alloc
+{
+    /**
+     * @brief Single-producer single-consumer byte ring whose memory is mapped twice in a row.
+     *
+     * The same physical pages (a memfd on Linux, an anonymous shared-memory object elsewhere,
+     * a pagefile-backed section on Windows) appear at [data, data + capacity) and again at
+     * [data + capacity, data + 2 * capacity). A write running past the end of the first view
+     * lands at the start of the buffer, so any span of up to capacity() bytes starting anywhere
+     * in the ring is contiguous in virtual memory. Writers never split a record at the wrap
+     * point and readers never reassemble one: there is no wrap branch and no boundary copy.
+     *
+     * The ring is a byte stream: the producer reserve()s contiguous space and commit()s the
+     * bytes it wrote, and the consumer peek()s at everything committed and consume()s a prefix.
+     *
+     * Example:
+     * @code
+     * MirroredRingBuffer stream(1 << 20);
+     * // Network thread
+     * if (void* space = stream.reserve(64 * 1024)) { stream.commit(recv(socket, space, 64 * 1024)); }
+     * // Parser thread: frames straddling the wrap point are still contiguous
+     * std::size_t size;
+     * while (const void* bytes = stream.peek(&size, sizeof(FrameHeader))) {
+     *     const std::size_t used = parse_frames(bytes, size); // Zero-copy
+     *     if (used == 0) { break; }
+     *     stream.consume(used);
+     * }
+     * @endcode
+     *
+     * @note Thread-safety: One producer thread (reserve/commit) and one consumer thread
+     *       (peek/consume) may run concurrently. Head and tail are atomics on separate cache
+     *       lines, and each side re-reads the other's position only when it runs short.
+     * @note Capacity is rounded up to the page size (the 64 KiB allocation granularity on
+     *       Windows), and uses twice that much address space but only capacity() bytes of memory.
+     */
+    class MirroredRingBuffer
+    {
+    public:
+        /**
+         * @brief Map a mirrored ring.
+         *
+         * @param capacity Minimum size in bytes (power of 2, > 0); rounded up to the page size
+         * @throws assert if capacity is invalid or the mapping fails
+         */
+        explicit MirroredRingBuffer(std::size_t capacity);
+        ~MirroredRingBuffer();
+
+        // Pinned: the producer and consumer threads hold references
+        MirroredRingBuffer(const MirroredRingBuffer&) = delete;
+        MirroredRingBuffer& operator=(const MirroredRingBuffer&) = delete;
+
+        /**
+         * @brief Get contiguous space for @p size bytes at the head. Producer only.
+         *
+         * @return Pointer to the space, or nullptr if fewer than @p size bytes are free
+         * @note Complexity: O(1); the space never wraps
+         */
+        [[nodiscard]] void* reserve(std::size_t size) noexcept;
+
+        /**
+         * @brief Publish the first @p size bytes written at reserve()'s pointer. Producer only.
+         * @param size Bytes to publish (<= the reserved size)
+         */
+        void commit(std::size_t size) noexcept;
+
+        /**
+         * @brief Get every committed byte not yet consumed, contiguously. Consumer only.
+         *
+         * @param[out] size Set to the number of readable bytes
+         * @param min_size Re-read the producer's position if fewer than this many are known (> 0)
+         * @return Pointer to the oldest byte, or nullptr if fewer than @p min_size are readable
+         */
+        [[nodiscard]] const void* peek(std::size_t* size, std::size_t min_size = 1) noexcept;
+
+        /** @brief Discard the first @p size readable bytes. Consumer only. */
+        void consume(std::size_t size) noexcept;
+
+        /** @brief Get the capacity in bytes (after rounding to the page size). */
+        [[nodiscard]] std::size_t capacity() const noexcept { return capacity_; }
+
+        /** @brief Get the first view; the second starts at data() + capacity(). */
+        [[nodiscard]] void* data() const noexcept { return data_; }
+
+        /** @brief Get the bytes committed but not yet consumed (approximate while in use). */
+        [[nodiscard]] std::size_t used() const noexcept
+        {
+            return static_cast<std::size_t>(head_.load(std::memory_order_acquire) -
+                                             tail_.load(std::memory_order_acquire));
+        }
+
+        /** @brief Check whether no committed bytes are waiting (approximate while in use). */
+        [[nodiscard]] bool empty() const noexcept { return used() == 0; }
+
+    private:
+        std::byte* data_;
+        std::size_t capacity_;
+        std::size_t mask_;
+
+        // Producer cache line
+        alignas(64) std::atomic<std::uint64_t> head_; ///< Total bytes committed
+        std::uint64_t cached_tail_; ///< Producer's last view of tail_
+
+        // Consumer cache line
+        alignas(64) std::atomic<std::uint64_t> tail_; ///< Total bytes consumed
+        std::uint64_t cached_head_; ///< Consumer's last view of head_
+
+        /** @brief Map the two views of a capacity_-byte object; nullptr on failure. */
+        [[nodiscard]] std::byte* map_mirrored() const noexcept;
+
+        /** @brief Page size, or allocation granularity on Windows. */
+        [[nodiscard]] static std::size_t mapping_granularity() noexcept;
+    };
+} // namespace fast_alloc
@@ -1,143 +1,50 @@
 #include "pool_allocator.h"
 
-#include <cassert>
-#include <cstring>
-
-#ifdef _WIN32
-#include <malloc.h>
-#else
-#include <cstdlib>
-#endif
-
 namespace fast_alloc
 {
-    PoolAllocator::PoolAllocator(const std::size_t block_size, const std::size_t block_count)
-        : block_size_(block_size)
-          , block_count_(block_count)
-          , allocated_count_(0)
-          , memory_(nullptr)
-          , free_list_(nullptr)
-    {
-        assert(block_size >= sizeof(void*) && "Block size must be at least pointer size");
-        assert(block_count > 0 && "Block count must be greater than zero");
-
-#ifdef _WIN32
-        memory_ = _aligned_malloc(block_size_ * block_count_, alignof(std::max_align_t));
-#else
-        memory_ = std::aligned_alloc(alignof(std::max_align_t), block_size_ * block_count_);
-#endif
-        assert(memory_ && "Failed to allocate memory pool");
-
-        // Initialise free list - each block points to the next
-        auto* block = static_cast<std::byte*>(memory_);
-        free_list_ = block;
-
-        for (std::size_t i = 0; i < block_count_ - 1; ++i)
-        {
-            const auto current = reinterpret_cast<void**>(block);
-            block += block_size_;
-            *current = block;
-        }
-
-        // Last block points to nullptr
-        const auto last = reinterpret_cast<void**>(block);
-        *last = nullptr;
-    }
-
-    PoolAllocator::~PoolAllocator()
+    namespace detail
     {
-        if (memory_)
+        std::size_t find_set_run(const std::vector<std::uint64_t>& bitmap, const std::size_t bit_count,
+                                 const std::size_t length)
         {
-#ifdef _WIN32
-            _aligned_free(memory_);
-#else
-            std::free(memory_);
-#endif
-        }
-    }
-
-    PoolAllocator::PoolAllocator(PoolAllocator&& other) noexcept
-        : block_size_(other.block_size_)
-          , block_count_(other.block_count_)
-          , allocated_count_(other.allocated_count_)
-          , memory_(other.memory_)
-          , free_list_(other.free_list_)
-    {
-        other.memory_ = nullptr;
-        other.free_list_ = nullptr;
-        other.allocated_count_ = 0;
-    }
+            std::size_t run_start = 0;
+            std::size_t run_length = 0;
 
-    PoolAllocator& PoolAllocator::operator=(PoolAllocator&& other) noexcept
-    {
-        if (this != &other)
-        {
-            if (memory_)
+            for (std::size_t index = 0; index < bit_count;)
             {
-#ifdef _WIN32
-                _aligned_free(memory_);
-#else
-                std::free(memory_);
-#endif
+                const std::uint64_t word = bitmap[index / 64];
+
+                // Skip whole words with no free blocks
+                if (index % 64 == 0 && word == 0)
+                {
+                    run_length = 0;
+                    index += 64;
+                    continue;
+                }
+
+                if (word & (std::uint64_t{1} << (index % 64)))
+                {
+                    if (run_length == 0)
+                    {
+                        run_start = index;
+                    }
+                    if (++run_length == length)
+                    {
+                        return run_start;
+                    }
+                }
+                else
+                {
+                    run_length = 0;
+                }
+                ++index;
             }
 
-            block_size_ = other.block_size_;
-            block_count_ = other.block_count_;
-            allocated_count_ = other.allocated_count_;
-            memory_ = other.memory_;
-            free_list_ = other.free_list_;
-
-            other.memory_ = nullptr;
-            other.free_list_ = nullptr;
-            other.allocated_count_ = 0;
+            return bit_count;
         }
-        return *this;
-    }
-
-    void* PoolAllocator::allocate()
-    {
-        if (!free_list_)
-        {
-            return nullptr; // Pool exhausted
-        }
-
-        // Pop from free list
-        void* block = free_list_;
-        free_list_ = *static_cast<void**>(free_list_);
-        ++allocated_count_;
-
-        return block;
-    }
-
-    void PoolAllocator::deallocate(void* ptr)
-    {
-        if (!ptr)
-        {
-            return;
-        }
-
-        assert(allocated_count_ > 0 && "Deallocating from empty pool");
-
-        // Validate pointer is within our memory range
-        const auto ptr_address = reinterpret_cast<std::size_t>(ptr);
-        const auto memory_start = reinterpret_cast<std::size_t>(memory_);
-        const auto memory_end = memory_start + (block_size_ * block_count_);
-
-        assert(ptr_address >= memory_start && ptr_address < memory_end
-            && "Pointer outside pool memory range");
-
-        // Validate pointer is properly aligned to a block boundary
-        assert((ptr_address - memory_start) % block_size_ == 0
-            && "Pointer not aligned to block boundary");
-
-        // Suppress unused variable warnings in release builds
-        (void)ptr_address;
-        (void)memory_end;
+    } // namespace detail
 
-        // Push back to free list
-        const auto block = static_cast<void**>(ptr);
-        *block = free_list_;
-        free_list_ = ptr;
-        --allocated_count_;
-    }
+    template class BasicPoolAllocator<PoolConfig>;
+    template class BasicPoolAllocator<LeanPoolConfig>;
+    template class BasicPoolAllocator<CheckedPoolConfig>;
 } // namespace fast_alloc
@@ -1,77 +1,732 @@
 #pragma once
 
+#include "allocator_config.h"
+#include "reclaim_registry.h"
+
+#include <atomic>
+#include <bit>
+#include <cassert>
 #include <cstddef>
 #include <cstdint>
+#include <mutex>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 namespace fast_alloc
 {
+    /**
+     * @brief Where a pool keeps track of its free blocks.
+     */
+    enum class FreeSlotTracking
+    {
+        Intrusive, ///< Next pointer stored in each free block (zero overhead, writes to freed memory)
+        OutOfBand  ///< Side stack of 32-bit block indices (4 bytes per block, never touches freed memory)
+    };
+
+    namespace detail
+    {
+        /**
+         * @brief Find the first run of @p length set bits in a bitmap of @p bit_count bits.
+         * @return Index of the first bit in the run, or bit_count if there is none.
+         */
+        std::size_t find_set_run(const std::vector<std::uint64_t>& bitmap, std::size_t bit_count,
+                                 std::size_t length);
+    } // namespace detail
+
     /**
      * @brief Fixed-size block memory pool allocator.
-     * 
+     *
      * Extremely fast O(1) allocation/deallocation for objects of uniform size.
      * Ideal for particle systems, game entities, audio voices, and network packets.
-     * 
-     * @note Thread-safety: Not thread-safe. Use ThreadSafePoolAllocator for concurrent access.
-     * @note Memory overhead: 0 bytes per allocation (uses free space for intrusive list).
+     *
+     * Features are selected at compile time by @p Config (see PoolConfig): locking, the
+     * allocation counter, pointer validation, double-free detection, the default alignment and
+     * the memory backend. Disabled features compile out completely. PoolAllocator,
+     * ThreadSafePoolAllocator, LeanPoolAllocator and CheckedPoolAllocator name the common
+     * configurations.
+     *
+     * @note Thread-safety: Not thread-safe, unless Config::thread_safe - then every member is
+     *       serialised on a std::mutex and the pool cannot be moved.
+     * @note Memory overhead: 0 bytes per allocation (uses free space for intrusive list),
+     *       or 4 bytes per block with FreeSlotTracking::OutOfBand, plus a bitmap of free blocks
+     *       (1 bit per block) for contiguous runs, locality rebuilds and double-free detection.
      * @note Fragmentation: None (all blocks same size).
-     * 
-     * @warning Block size must be at least sizeof(void*) to store free list pointers.
+     * @note Out-of-band tracking: Construction, allocation and deallocation never read or write
+     *       block memory, so freed blocks stay clean in copy-on-write children, pages released with
+     *       MADV_FREE are not faulted back in, and cold blocks are not pulled into cache on free.
+     * @note Alignment: Every block starts on a multiple of the configured alignment. Use a
+     *       cache-line (64) or prefetch-pair (128) alignment to keep blocks owned by different
+     *       cores from sharing a line, or a page alignment for page-granular blocks.
+     *
+     * @warning With intrusive tracking, block size must be at least sizeof(void*) to store free
+     *          list pointers.
      */
-    class PoolAllocator
+    template <typename Config = PoolConfig>
+    class BasicPoolAllocator
     {
     public:
+        using config_type = Config;
+
         /**
          * @brief Construct a pool allocator.
-         * 
-         * @param block_size Size in bytes of each block (must be >= sizeof(void*))
-         * @param block_count Number of blocks to allocate
-         * @throws assert if block_size < sizeof(void*) or block_count == 0
+         *
+         * @param block_size Size in bytes of each block (must be >= sizeof(void*) for intrusive tracking)
+         * @param block_count Number of blocks to allocate (must fit in 32 bits for out-of-band tracking)
+         * @param alignment Alignment of every block (power of 2, >= alignof(void*)).
+         *        The block stride is rounded up to a multiple of this value.
+         * @param tracking Free-slot tracking mode (Intrusive or OutOfBand)
+         * @throws assert if block_size is too small, block_count == 0 or alignment is invalid
          */
-        PoolAllocator(std::size_t block_size, std::size_t block_count);
-        ~PoolAllocator();
+        BasicPoolAllocator(std::size_t block_size, std::size_t block_count,
+                           std::size_t alignment = Config::alignment,
+                           FreeSlotTracking tracking = FreeSlotTracking::Intrusive);
+        ~BasicPoolAllocator();
 
         // Disable copy
-        PoolAllocator(const PoolAllocator&) = delete;
-        PoolAllocator& operator=(const PoolAllocator&) = delete;
+        BasicPoolAllocator(const BasicPoolAllocator&) = delete;
+        BasicPoolAllocator& operator=(const BasicPoolAllocator&) = delete;
 
-        // Enable move
-        PoolAllocator(PoolAllocator&& other) noexcept;
-        PoolAllocator& operator=(PoolAllocator&& other) noexcept;
+        // Enable move (disabled with a mutex - unsafe under concurrent access)
+        BasicPoolAllocator(BasicPoolAllocator&& other) noexcept requires (!Config::thread_safe);
+        BasicPoolAllocator& operator=(BasicPoolAllocator&& other) noexcept requires (!Config::thread_safe);
 
         /**
          * @brief Allocate a single block from the pool.
-         * 
-         * @return Pointer to allocated block, or nullptr if pool is exhausted.
-         * @note Complexity: O(1) - single pointer dereference
+         *
+         * @return Pointer to allocated block, or nullptr if pool is exhausted (after running the
+         *         reclaim registry, if one is set).
+         * @note Complexity: O(1) - single pointer dereference (or index stack pop)
          */
         void* allocate();
 
         /**
          * @brief Return a block to the pool.
-         * 
+         *
          * @param ptr Pointer to block (must be from this allocator). nullptr is safely ignored.
-         * @note Complexity: O(1) - two pointer assignments
-         * @warning Passing invalid pointers will trigger assertions in debug builds.
+         * @note Complexity: O(1) - two pointer assignments (or index stack push)
+         * @warning Passing invalid pointers aborts with Config::validate (debug builds by default);
+         *          otherwise it is not checked.
          */
         void deallocate(void* ptr);
 
+        /**
+         * @brief Allocate @p count adjacent blocks as a single contiguous run.
+         *
+         * @param count Number of blocks in the run (must be > 0)
+         * @return Pointer to the first block of the run, or nullptr if no free run is long enough.
+         * @note Complexity: O(capacity / 64) to search the free-block bitmap for a run, plus one
+         *       pass over the free list to unlink the claimed blocks. Never allocates, and the
+         *       other free blocks keep their order.
+         * @note Block i of the run is at ptr + i * block_stride().
+         */
+        void* allocate_contiguous(std::size_t count);
+
+        /**
+         * @brief Return a run obtained from allocate_contiguous() to the pool.
+         *
+         * @param ptr Pointer to the first block of the run. nullptr is safely ignored.
+         * @param count Number of blocks in the run (must match allocate_contiguous())
+         * @note Complexity: O(count)
+         */
+        void deallocate_contiguous(void* ptr, std::size_t count);
+
+        /**
+         * @brief Rebuild the free list in ascending address order.
+         *
+         * After many random frees the LIFO free list hands out blocks scattered across pages.
+         * Sorting it restores sequential allocation order for better TLB and prefetcher behaviour.
+         *
+         * @note Complexity: O(n) in capacity - relinks the blocks marked in the free-block bitmap.
+         */
+        void optimize_locality();
+
+        /**
+         * @brief Automatically run optimize_locality() every @p interval deallocations.
+         *
+         * @param interval Deallocations between rebuilds, or 0 to disable (default)
+         * @note The triggering deallocate() pays the O(n) rebuild.
+         */
+        void set_locality_interval(std::size_t interval) noexcept;
+
+        /** @brief Get the automatic locality rebuild interval (0 when disabled). */
+        [[nodiscard]] std::size_t locality_interval() const noexcept { return locality_interval_; }
+
+        /**
+         * @brief Run @p registry's callbacks when the pool is exhausted, then retry once.
+         *
+         * @param registry Registry to consult (must outlive the pool), or nullptr to disable (default)
+         * @note Callbacks may deallocate() into this pool; allocations they make never reclaim again.
+         * @note Set before sharing a thread-safe pool between threads.
+         */
+        void set_reclaim_registry(ReclaimRegistry* registry) noexcept { reclaim_registry_ = registry; }
+
+        /** @brief Get the reclaim registry, or nullptr if none is set. */
+        [[nodiscard]] ReclaimRegistry* reclaim_registry() const noexcept { return reclaim_registry_; }
+
         /** @brief Get the size of each block in bytes. */
         [[nodiscard]] std::size_t block_size() const noexcept { return block_size_; }
 
+        /** @brief Get the distance in bytes between consecutive blocks (block size rounded up to alignment). */
+        [[nodiscard]] std::size_t block_stride() const noexcept { return block_stride_; }
+
+        /** @brief Get the alignment of every block in bytes. */
+        [[nodiscard]] std::size_t alignment() const noexcept { return alignment_; }
+
+        /** @brief Get the free-slot tracking mode. */
+        [[nodiscard]] FreeSlotTracking tracking() const noexcept { return tracking_; }
+
         /** @brief Get the total capacity (number of blocks). */
         [[nodiscard]] std::size_t capacity() const noexcept { return block_count_; }
 
-        /** @brief Get the number of currently allocated blocks. */
-        [[nodiscard]] std::size_t allocated() const noexcept { return allocated_count_; }
+        /** @brief Get the start of the pool memory (block_stride() * capacity() bytes). */
+        [[nodiscard]] void* data() const noexcept { return memory_; }
+
+        /**
+         * @brief Get the number of currently allocated blocks.
+         * @note Only available with Config::statistics. Uses relaxed memory ordering when thread-safe.
+         */
+        [[nodiscard]] std::size_t allocated() const noexcept requires Config::statistics
+        {
+            if constexpr (Config::thread_safe)
+            {
+                return allocated_count_.load(std::memory_order_relaxed);
+            }
+            else
+            {
+                return allocated_count_;
+            }
+        }
 
         /** @brief Check if the pool is full (no blocks available). */
-        [[nodiscard]] bool is_full() const noexcept { return allocated_count_ >= block_count_; }
+        [[nodiscard]] bool is_full() const noexcept
+        {
+            if constexpr (Config::statistics)
+            {
+                return allocated() >= block_count_;
+            }
+            else
+            {
+                std::lock_guard lock(mutex_);
+                return tracking_ == FreeSlotTracking::OutOfBand ? free_top_ == 0 : free_list_ == nullptr;
+            }
+        }
 
     private:
+        using Mutex = std::conditional_t<Config::thread_safe, std::mutex, detail::NullMutex>;
+        using Counter = std::conditional_t<Config::thread_safe, std::atomic<std::size_t>, std::size_t>;
+
+        [[no_unique_address]] mutable Mutex mutex_; // Serialises every member when thread-safe
         std::size_t block_size_;
+        std::size_t block_stride_;
+        int stride_shift_;  // log2(block_stride_) when it is a power of 2, else -1
+        std::size_t alignment_;
         std::size_t block_count_;
-        std::size_t allocated_count_;
+        [[no_unique_address]] std::conditional_t<Config::statistics, Counter, detail::Disabled<Counter>> allocated_count_;
+        std::size_t locality_interval_;
+        std::size_t deallocations_since_sort_;
+        FreeSlotTracking tracking_;
         void* memory_;
         void* free_list_;  // Intrusive linked list of free blocks
+        std::vector<std::uint32_t> free_indices_; // Out-of-band stack of free block indices
+        std::size_t free_top_;                    // Number of entries in free_indices_
+        ReclaimRegistry* reclaim_registry_;       // Consulted before allocate() gives up
+        std::vector<std::uint64_t> free_blocks_;  // Bit per free block
+
+        /** @brief Pop a free block, or nullptr if there is none. Caller holds the lock. */
+        void* pop_block() noexcept;
+
+        /** @brief Validate and push a block back onto the free set. Caller holds the lock. */
+        void push_block(void* ptr) noexcept;
+
+        /** @brief Slow path of allocate(): reclaim, then retry once. */
+        void* allocate_after_reclaim();
+
+        /** @brief Rebuild the free list; caller holds the lock. */
+        void optimize_locality_locked();
+
+        /** @brief Add @p count to the allocation counter, if there is one. Caller holds the lock. */
+        void count_allocated(std::ptrdiff_t count) noexcept
+        {
+            if constexpr (Config::thread_safe && Config::statistics)
+            {
+                // Written under the lock only, so no read-modify-write is needed
+                allocated_count_.store(allocated_count_.load(std::memory_order_relaxed) + static_cast<std::size_t>(count),
+                                       std::memory_order_relaxed);
+            }
+            else if constexpr (Config::statistics)
+            {
+                allocated_count_ += static_cast<std::size_t>(count);
+            }
+            else
+            {
+                (void)count;
+            }
+        }
+
+        /** @brief Get the index of the block at @p ptr. */
+        [[nodiscard]] std::size_t block_index(const void* ptr) const noexcept
+        {
+            const std::size_t offset = reinterpret_cast<std::size_t>(ptr) - reinterpret_cast<std::size_t>(memory_);
+            return stride_shift_ >= 0 ? offset >> stride_shift_ : offset / block_stride_;
+        }
+
+        /** @brief Take blocks [first, first + count) off the free list, keeping the others' order. Caller holds the lock. */
+        void unlink_run(std::size_t first, std::size_t count) noexcept;
+
+        /** @brief Replace the free set with the blocks in @p bitmap, handed out in ascending address order. */
+        void rebuild_free_list(const std::vector<std::uint64_t>& bitmap);
     };
+
+    template <typename Config>
+    BasicPoolAllocator<Config>::BasicPoolAllocator(const std::size_t block_size, const std::size_t block_count,
+                                                   const std::size_t alignment, const FreeSlotTracking tracking)
+        : block_size_(block_size)
+          , block_stride_((block_size + alignment - 1) & ~(alignment - 1))
+          , stride_shift_(std::has_single_bit(block_stride_) ? std::countr_zero(block_stride_) : -1)
+          , alignment_(alignment)
+          , block_count_(block_count)
+          , allocated_count_()
+          , locality_interval_(0)
+          , deallocations_since_sort_(0)
+          , tracking_(tracking)
+          , memory_(nullptr)
+          , free_list_(nullptr)
+          , free_top_(0)
+          , reclaim_registry_(nullptr)
+    {
+        assert((tracking == FreeSlotTracking::OutOfBand || block_size >= sizeof(void*))
+            && "Block size must be at least pointer size");
+        assert(block_count > 0 && "Block count must be greater than zero");
+        assert((tracking == FreeSlotTracking::Intrusive || block_count <= UINT32_MAX)
+            && "Block count must fit in 32 bits for out-of-band tracking");
+        assert((alignment & (alignment - 1)) == 0 && "Alignment must be power of 2");
+        assert(alignment >= alignof(void*) && "Alignment must be at least pointer alignment");
+
+        memory_ = Config::Backend::allocate(block_stride_ * block_count_, alignment_);
+        assert(memory_ && "Failed to allocate memory pool");
+
+        // Every block starts free; bits past the last block stay clear
+        free_blocks_.assign((block_count_ + 63) / 64, ~std::uint64_t{0});
+        if (block_count_ % 64 != 0)
+        {
+            free_blocks_.back() = (std::uint64_t{1} << (block_count_ % 64)) - 1;
+        }
+
+        if (tracking_ == FreeSlotTracking::OutOfBand)
+        {
+            // Stack of indices, top holds block 0 so blocks come out in address order.
+            // Block memory is left untouched.
+            free_indices_.resize(block_count_);
+            for (std::size_t i = 0; i < block_count_; ++i)
+            {
+                free_indices_[i] = static_cast<std::uint32_t>(block_count_ - 1 - i);
+            }
+            free_top_ = block_count_;
+            return;
+        }
+
+        // Initialise free list - each block points to the next
+        auto* block = static_cast<std::byte*>(memory_);
+        free_list_ = block;
+
+        for (std::size_t i = 0; i < block_count_ - 1; ++i)
+        {
+            const auto current = reinterpret_cast<void**>(block);
+            block += block_stride_;
+            *current = block;
+        }
+
+        // Last block points to nullptr
+        const auto last = reinterpret_cast<void**>(block);
+        *last = nullptr;
+    }
+
+    template <typename Config>
+    BasicPoolAllocator<Config>::~BasicPoolAllocator()
+    {
+        if (memory_)
+        {
+            Config::Backend::deallocate(memory_, block_stride_ * block_count_);
+        }
+    }
+
+    template <typename Config>
+    BasicPoolAllocator<Config>::BasicPoolAllocator(BasicPoolAllocator&& other) noexcept
+        requires (!Config::thread_safe)
+        : block_size_(other.block_size_)
+          , block_stride_(other.block_stride_)
+          , stride_shift_(other.stride_shift_)
+          , alignment_(other.alignment_)
+          , block_count_(other.block_count_)
+          , allocated_count_(other.allocated_count_)
+          , locality_interval_(other.locality_interval_)
+          , deallocations_since_sort_(other.deallocations_since_sort_)
+          , tracking_(other.tracking_)
+          , memory_(other.memory_)
+          , free_list_(other.free_list_)
+          , free_indices_(std::move(other.free_indices_))
+          , free_top_(other.free_top_)
+          , reclaim_registry_(other.reclaim_registry_)
+          , free_blocks_(std::move(other.free_blocks_))
+    {
+        other.memory_ = nullptr;
+        other.free_list_ = nullptr;
+        other.free_top_ = 0;
+        other.allocated_count_ = {};
+    }
+
+    template <typename Config>
+    BasicPoolAllocator<Config>& BasicPoolAllocator<Config>::operator=(BasicPoolAllocator&& other) noexcept
+        requires (!Config::thread_safe)
+    {
+        if (this != &other)
+        {
+            if (memory_)
+            {
+                Config::Backend::deallocate(memory_, block_stride_ * block_count_);
+            }
+
+            block_size_ = other.block_size_;
+            block_stride_ = other.block_stride_;
+            stride_shift_ = other.stride_shift_;
+            alignment_ = other.alignment_;
+            block_count_ = other.block_count_;
+            allocated_count_ = other.allocated_count_;
+            locality_interval_ = other.locality_interval_;
+            deallocations_since_sort_ = other.deallocations_since_sort_;
+            tracking_ = other.tracking_;
+            memory_ = other.memory_;
+            free_list_ = other.free_list_;
+            free_indices_ = std::move(other.free_indices_);
+            free_top_ = other.free_top_;
+            reclaim_registry_ = other.reclaim_registry_;
+            free_blocks_ = std::move(other.free_blocks_);
+
+            other.memory_ = nullptr;
+            other.free_list_ = nullptr;
+            other.free_top_ = 0;
+            other.allocated_count_ = {};
+        }
+        return *this;
+    }
+
+    template <typename Config>
+    void* BasicPoolAllocator<Config>::allocate()
+    {
+        {
+            std::lock_guard lock(mutex_);
+            if (void* block = pop_block())
+            {
+                return block;
+            }
+        }
+
+        return allocate_after_reclaim(); // Pool exhausted
+    }
+
+    template <typename Config>
+    void* BasicPoolAllocator<Config>::pop_block() noexcept
+    {
+        void* block;
+
+        if (tracking_ == FreeSlotTracking::OutOfBand)
+        {
+            if (free_top_ == 0)
+            {
+                return nullptr;
+            }
+
+            // Pop index from side stack - block memory is never read
+            const std::uint32_t index = free_indices_[--free_top_];
+            block = static_cast<std::byte*>(memory_) + index * block_stride_;
+        }
+        else
+        {
+            if (!free_list_)
+            {
+                return nullptr;
+            }
+
+            // Pop from free list
+            block = free_list_;
+            free_list_ = *static_cast<void**>(free_list_);
+        }
+
+        const std::size_t index = block_index(block);
+        free_blocks_[index / 64] &= ~(std::uint64_t{1} << (index % 64));
+        count_allocated(1);
+
+        return block;
+    }
+
+    template <typename Config>
+    void* BasicPoolAllocator<Config>::allocate_after_reclaim()
+    {
+        if (!reclaim_registry_ || reclaim_registry_->reclaim(block_size_) == 0)
+        {
+            return nullptr;
+        }
+
+        // Retry without reclaiming again; callbacks allocating from this pool while reclaim runs
+        // find the registry's reentrancy guard set and fail immediately
+        std::lock_guard lock(mutex_);
+        return pop_block();
+    }
+
+    template <typename Config>
+    void BasicPoolAllocator<Config>::deallocate(void* ptr)
+    {
+        if (!ptr)
+        {
+            return;
+        }
+
+        std::lock_guard lock(mutex_);
+        push_block(ptr);
+
+        if (locality_interval_ && ++deallocations_since_sort_ >= locality_interval_)
+        {
+            optimize_locality_locked();
+        }
+    }
+
+    template <typename Config>
+    void BasicPoolAllocator<Config>::push_block(void* ptr) noexcept
+    {
+        const auto ptr_address = reinterpret_cast<std::size_t>(ptr);
+        const auto memory_start = reinterpret_cast<std::size_t>(memory_);
+
+        if constexpr (Config::validate && Config::statistics)
+        {
+            if (allocated() == 0)
+            {
+                detail::validation_failure("Deallocating from empty pool");
+            }
+        }
+
+        if constexpr (Config::validate || Config::detect_double_free)
+        {
+            // Validate pointer is within our memory range
+            const auto memory_end = memory_start + (block_stride_ * block_count_);
+            if (ptr_address < memory_start || ptr_address >= memory_end)
+            {
+                detail::validation_failure("Pointer outside pool memory range");
+            }
+
+            // Validate pointer is properly aligned to a block boundary
+            if ((ptr_address - memory_start) % block_stride_ != 0)
+            {
+                detail::validation_failure("Pointer not aligned to block boundary");
+            }
+        }
+
+        const std::size_t index = block_index(ptr);
+        const std::uint64_t bit = std::uint64_t{1} << (index % 64);
+        if constexpr (Config::detect_double_free)
+        {
+            if (free_blocks_[index / 64] & bit)
+            {
+                detail::validation_failure("Block freed twice or never allocated");
+            }
+        }
+        free_blocks_[index / 64] |= bit;
+
+        if (tracking_ == FreeSlotTracking::OutOfBand)
+        {
+            // Push index onto side stack - block memory is never written
+            free_indices_[free_top_++] = static_cast<std::uint32_t>(index);
+        }
+        else
+        {
+            // Push back to free list
+            const auto block = static_cast<void**>(ptr);
+            *block = free_list_;
+            free_list_ = ptr;
+        }
+        count_allocated(-1);
+    }
+
+    template <typename Config>
+    void* BasicPoolAllocator<Config>::allocate_contiguous(const std::size_t count)
+    {
+        assert(count > 0 && "Run length must be greater than zero");
+
+        if (count == 1)
+        {
+            return allocate();
+        }
+
+        std::lock_guard lock(mutex_);
+
+        if (!memory_ || count > block_count_)
+        {
+            return nullptr;
+        }
+        if constexpr (Config::statistics)
+        {
+            if (count > block_count_ - allocated())
+            {
+                return nullptr;
+            }
+        }
+
+        const std::size_t first = detail::find_set_run(free_blocks_, block_count_, count);
+        if (first == block_count_)
+        {
+            return nullptr; // Enough free blocks, but none adjacent
+        }
+
+        // Claim the run: clear its bits and take just those blocks off the free list
+        for (std::size_t index = first; index < first + count; ++index)
+        {
+            free_blocks_[index / 64] &= ~(std::uint64_t{1} << (index % 64));
+        }
+        unlink_run(first, count);
+        count_allocated(static_cast<std::ptrdiff_t>(count));
+
+        return static_cast<std::byte*>(memory_) + first * block_stride_;
+    }
+
+    template <typename Config>
+    void BasicPoolAllocator<Config>::deallocate_contiguous(void* ptr, const std::size_t count)
+    {
+        if (!ptr)
+        {
+            return;
+        }
+
+        assert(count > 0 && "Run length must be greater than zero");
+
+        std::lock_guard lock(mutex_);
+
+        // Push in reverse so the run is handed out again in address order
+        auto* const first = static_cast<std::byte*>(ptr);
+        for (std::size_t i = count; i > 0; --i)
+        {
+            push_block(first + (i - 1) * block_stride_);
+        }
+
+        if (locality_interval_ && (deallocations_since_sort_ += count) >= locality_interval_)
+        {
+            optimize_locality_locked();
+        }
+    }
+
+    template <typename Config>
+    void BasicPoolAllocator<Config>::optimize_locality()
+    {
+        std::lock_guard lock(mutex_);
+        optimize_locality_locked();
+    }
+
+    template <typename Config>
+    void BasicPoolAllocator<Config>::optimize_locality_locked()
+    {
+        if (!memory_)
+        {
+            return;
+        }
+
+        rebuild_free_list(free_blocks_);
+        deallocations_since_sort_ = 0;
+    }
+
+    template <typename Config>
+    void BasicPoolAllocator<Config>::set_locality_interval(const std::size_t interval) noexcept
+    {
+        std::lock_guard lock(mutex_);
+        locality_interval_ = interval;
+        deallocations_since_sort_ = 0;
+    }
+
+    template <typename Config>
+    void BasicPoolAllocator<Config>::unlink_run(const std::size_t first, const std::size_t count) noexcept
+    {
+        if (tracking_ == FreeSlotTracking::OutOfBand)
+        {
+            // Compact the side stack in place - block memory is never read
+            std::size_t kept = 0;
+            for (std::size_t i = 0; i < free_top_; ++i)
+            {
+                const std::uint32_t index = free_indices_[i];
+                if (index < first || index >= first + count)
+                {
+                    free_indices_[kept++] = index;
+                }
+            }
+            free_top_ = kept;
+            return;
+        }
+
+        auto* const begin = static_cast<std::byte*>(memory_) + first * block_stride_;
+        auto* const end = begin + count * block_stride_;
+
+        // Splice each claimed block out of the list; stop once all of them are found
+        std::size_t remaining = count;
+        for (void** link = &free_list_; remaining > 0;)
+        {
+            auto* const block = static_cast<std::byte*>(*link);
+            if (block >= begin && block < end)
+            {
+                *link = *reinterpret_cast<void**>(block);
+                --remaining;
+            }
+            else
+            {
+                link = reinterpret_cast<void**>(block);
+            }
+        }
+    }
+
+    template <typename Config>
+    void BasicPoolAllocator<Config>::rebuild_free_list(const std::vector<std::uint64_t>& bitmap)
+    {
+        if (tracking_ == FreeSlotTracking::OutOfBand)
+        {
+            // Fill the stack from the highest index down so the lowest address is on top
+            free_top_ = 0;
+            for (std::size_t word = bitmap.size(); word-- > 0;)
+            {
+                for (std::uint64_t bits = bitmap[word]; bits;)
+                {
+                    const int top = 63 - std::countl_zero(bits);
+                    bits &= ~(std::uint64_t{1} << top);
+                    free_indices_[free_top_++] = static_cast<std::uint32_t>(word * 64 + static_cast<std::size_t>(top));
+                }
+            }
+            return;
+        }
+
+        auto* const base = static_cast<std::byte*>(memory_);
+        void** tail = &free_list_;
+
+        // Walk set bits in ascending order, appending each block to the list
+        for (std::size_t word = 0; word < bitmap.size(); ++word)
+        {
+            for (std::uint64_t bits = bitmap[word]; bits; bits &= bits - 1)
+            {
+                const std::size_t index = word * 64 + static_cast<std::size_t>(std::countr_zero(bits));
+                void* block = base + index * block_stride_;
+                *tail = block;
+                tail = static_cast<void**>(block);
+            }
+        }
+
+        *tail = nullptr;
+    }
+
+    // The standard configurations are compiled once, in the library
+    extern template class BasicPoolAllocator<PoolConfig>;
+    extern template class BasicPoolAllocator<LeanPoolConfig>;
+    extern template class BasicPoolAllocator<CheckedPoolConfig>;
+
+    /** @brief Single-threaded pool; validates pointers in debug builds only. */
+    using PoolAllocator = BasicPoolAllocator<PoolConfig>;
+
+    /** @brief Single-threaded pool without counters or checks, in any build. */
+    using LeanPoolAllocator = BasicPoolAllocator<LeanPoolConfig>;
+
+    /** @brief Single-threaded pool with range, boundary and double-free checks, in any build. */
+    using CheckedPoolAllocator = BasicPoolAllocator<CheckedPoolConfig>;
 } // namespace fast_alloc
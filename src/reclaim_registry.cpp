@@ -0,0 +1,179 @@
+#include "reclaim_registry.h"
+
+#include <algorithm>
+
+#if defined(__linux__)
+#include <cstdio>
+#include <unistd.h>
+#elif defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#include <psapi.h>
+#endif
+
+namespace fast_alloc
+{
+    namespace
+    {
+        thread_local bool reclaiming = false; ///< Set while this thread runs reclaim callbacks
+
+        /**
+         * @brief Marks the calling thread as reclaiming for the duration of a scope.
+         */
+        struct ReclaimingScope
+        {
+            ReclaimingScope() noexcept { reclaiming = true; }
+            ~ReclaimingScope() { reclaiming = false; }
+        };
+    } // namespace
+
+    ReclaimRegistry::Handle ReclaimRegistry::add(Callback callback, const int priority)
+    {
+        std::lock_guard lock(mutex_);
+
+        const Handle handle = next_handle_++;
+
+        // Insert after every entry of equal or lower priority to keep registration order
+        const auto position = std::upper_bound(entries_.begin(), entries_.end(), priority,
+                                               [](const int p, const Entry& entry) { return p < entry.priority; });
+        entries_.insert(position, Entry{std::move(callback), priority, handle});
+
+        return handle;
+    }
+
+    void ReclaimRegistry::remove(const Handle handle)
+    {
+        std::lock_guard lock(mutex_);
+
+        const auto it = std::find_if(entries_.begin(), entries_.end(),
+                                     [handle](const Entry& entry) { return entry.handle == handle; });
+        if (it != entries_.end())
+        {
+            entries_.erase(it);
+        }
+    }
+
+    std::size_t ReclaimRegistry::reclaim(const std::size_t bytes_wanted)
+    {
+        if (reclaiming)
+        {
+            return 0; // A callback ran out of memory - don't recurse
+        }
+
+        std::lock_guard lock(mutex_);
+        ReclaimingScope scope;
+
+        std::size_t freed = 0;
+        for (const Entry& entry : entries_)
+        {
+            freed += entry.callback(bytes_wanted - std::min(freed, bytes_wanted));
+            if (freed >= bytes_wanted)
+            {
+                break;
+            }
+        }
+
+        return freed;
+    }
+
+    void ReclaimRegistry::set_rss_threshold(const std::size_t bytes) noexcept
+    {
+        std::lock_guard lock(mutex_);
+        rss_threshold_ = bytes;
+    }
+
+    void ReclaimRegistry::set_pressure_threshold(const double percent, const std::size_t reclaim_bytes) noexcept
+    {
+        std::lock_guard lock(mutex_);
+        pressure_threshold_ = percent;
+        pressure_reclaim_bytes_ = reclaim_bytes;
+    }
+
+    std::size_t ReclaimRegistry::poll()
+    {
+        std::size_t rss_threshold;
+        double pressure_threshold;
+        std::size_t pressure_reclaim_bytes;
+        {
+            std::lock_guard lock(mutex_);
+            rss_threshold = rss_threshold_;
+            pressure_threshold = pressure_threshold_;
+            pressure_reclaim_bytes = pressure_reclaim_bytes_;
+        }
+
+        std::size_t wanted = 0;
+
+        if (rss_threshold > 0)
+        {
+            if (const std::size_t rss = resident_bytes(); rss > rss_threshold)
+            {
+                wanted = rss - rss_threshold;
+            }
+        }
+
+        if (pressure_threshold > 0.0 && memory_pressure() > pressure_threshold)
+        {
+            wanted = std::max(wanted, pressure_reclaim_bytes);
+        }
+
+        return wanted > 0 ? reclaim(wanted) : 0;
+    }
+
+    std::size_t ReclaimRegistry::size() const
+    {
+        std::lock_guard lock(mutex_);
+        return entries_.size();
+    }
+
+    std::size_t ReclaimRegistry::resident_bytes()
+    {
+#if defined(__linux__)
+        // statm: total program size, then resident pages
+        std::FILE* file = std::fopen("/proc/self/statm", "r");
+        if (!file)
+        {
+            return 0;
+        }
+
+        unsigned long total_pages = 0;
+        unsigned long resident_pages = 0;
+        const int fields = std::fscanf(file, "%lu %lu", &total_pages, &resident_pages);
+        std::fclose(file);
+
+        return fields == 2 ? resident_pages * static_cast<std::size_t>(sysconf(_SC_PAGESIZE)) : 0;
+#elif defined(_WIN32)
+        PROCESS_MEMORY_COUNTERS counters{};
+        if (!GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+        {
+            return 0;
+        }
+        return counters.WorkingSetSize;
+#else
+        return 0;
+#endif
+    }
+
+    double ReclaimRegistry::memory_pressure()
+    {
+#if defined(__linux__)
+        // First line: "some avg10=0.00 avg60=0.00 avg300=0.00 total=0"
+        std::FILE* file = std::fopen("/proc/pressure/memory", "r");
+        if (!file)
+        {
+            return -1.0; // Kernel without PSI
+        }
+
+        double avg10 = -1.0;
+        if (std::fscanf(file, "some avg10=%lf", &avg10) != 1)
+        {
+            avg10 = -1.0;
+        }
+        std::fclose(file);
+
+        return avg10;
+#else
+        return -1.0;
+#endif
+    }
+} // namespace fast_alloc
@@ -0,0 +1,120 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+namespace fast_alloc
+{
+    /**
+     * @brief Registry of callbacks that free memory on demand (cache eviction, pool trimming).
+     *
+     * Attach a registry to a PoolAllocator or FreeListAllocator with set_reclaim_registry():
+     * when the allocator is about to return nullptr it first calls reclaim(), letting caches
+     * drop entries back into it, and retries once. poll() runs the same callbacks when process
+     * RSS or memory pressure (Linux PSI) crosses a threshold, so caches can grow into all spare
+     * memory instead of being statically capped.
+     *
+     * Callbacks run in ascending priority order (cheapest caches first) until enough bytes have
+     * been freed. A callback that allocates while reclaim is running on the same thread does not
+     * trigger a nested reclaim.
+     *
+     * Example:
+     * @code
+     * ReclaimRegistry reclaim;
+     * pool.set_reclaim_registry(&reclaim);
+     * auto handle = reclaim.add([&](std::size_t wanted) { return texture_cache.evict(wanted); });
+     * @endcode
+     *
+     * @note Thread-safety: All members are thread-safe. Callbacks run under the registry lock, so
+     *       once remove() returns the callback is guaranteed not to be running. Callbacks must not
+     *       add() or remove() callbacks themselves.
+     */
+    class ReclaimRegistry
+    {
+    public:
+        /** @brief Frees memory; receives the bytes wanted and returns the bytes actually freed. */
+        using Callback = std::function<std::size_t(std::size_t bytes_wanted)>;
+
+        /** @brief Identifies a registered callback for remove(). */
+        using Handle = std::uint64_t;
+
+        ReclaimRegistry() = default;
+
+        // Pinned: allocators keep a pointer to their registry
+        ReclaimRegistry(const ReclaimRegistry&) = delete;
+        ReclaimRegistry& operator=(const ReclaimRegistry&) = delete;
+
+        /**
+         * @brief Register a reclaim callback.
+         *
+         * @param callback Function freeing memory
+         * @param priority Lower runs first; callbacks of equal priority run in registration order
+         * @return Handle for remove()
+         */
+        Handle add(Callback callback, int priority = 0);
+
+        /** @brief Unregister a callback. Unknown handles are ignored. */
+        void remove(Handle handle);
+
+        /**
+         * @brief Run callbacks until @p bytes_wanted bytes are freed or every callback has run.
+         *
+         * @return Total bytes the callbacks reported freeing; 0 if called from inside a callback.
+         */
+        std::size_t reclaim(std::size_t bytes_wanted);
+
+        /**
+         * @brief Reclaim when the process resident set exceeds @p bytes (0 disables).
+         * poll() then asks for the excess over the threshold.
+         */
+        void set_rss_threshold(std::size_t bytes) noexcept;
+
+        /**
+         * @brief Reclaim when memory pressure exceeds @p percent (0 disables).
+         *
+         * @param percent Share of time tasks stalled on memory over the last 10 s ("some avg10")
+         * @param reclaim_bytes Bytes to ask for each time poll() sees the threshold crossed
+         */
+        void set_pressure_threshold(double percent, std::size_t reclaim_bytes) noexcept;
+
+        /**
+         * @brief Check RSS and memory pressure against the thresholds and reclaim if crossed.
+         *
+         * Call periodically, e.g. once per frame or from a monitoring thread.
+         *
+         * @return Bytes reclaimed
+         * @note Reads /proc on Linux; only the RSS threshold is supported on Windows.
+         */
+        std::size_t poll();
+
+        /** @brief Get the number of registered callbacks. */
+        [[nodiscard]] std::size_t size() const;
+
+        /** @brief Get the process resident set size in bytes, or 0 if unavailable. */
+        [[nodiscard]] static std::size_t resident_bytes();
+
+        /** @brief Get the "some avg10" memory pressure percentage, or -1 if unavailable. */
+        [[nodiscard]] static double memory_pressure();
+
+    private:
+        /**
+         * @brief One registered callback.
+         */
+        struct Entry
+        {
+            Callback callback;
+            int priority;
+            Handle handle;
+        };
+
+        mutable std::mutex mutex_;
+        std::vector<Entry> entries_; ///< Sorted by priority, then registration order
+        Handle next_handle_ = 1;
+        std::size_t rss_threshold_ = 0;
+        double pressure_threshold_ = 0.0;
+        std::size_t pressure_reclaim_bytes_ = 0;
+    };
+} // namespace fast_alloc
@@ -0,0 +1,170 @@
+#include "spsc_ring_allocator.h"
+
+#include <cassert>
+
+#ifdef _WIN32
+#include <malloc.h>
+#else
+#include <cstdlib>
+#endif
+
+namespace fast_alloc
+{
+    namespace
+    {
+        constexpr std::size_t align_up(const std::size_t value, const std::size_t alignment) noexcept
+        {
+            return (value + alignment - 1) & ~(alignment - 1);
+        }
+    }
+
+    SpscRingAllocator::SpscRingAllocator(const std::size_t capacity)
+        : buffer_(nullptr)
+          , capacity_(capacity)
+          , mask_(capacity - 1)
+          , head_(0)
+          , cached_tail_(0)
+          , reserved_(0)
+          , reserved_end_(0)
+          , tail_(0)
+          , cached_head_(0)
+    {
+        assert(capacity >= max_alignment && (capacity & (capacity - 1)) == 0 &&
+            "Capacity must be a power of 2 of at least max_alignment");
+        assert(capacity <= UINT32_MAX && "Record lengths are 32-bit");
+
+#ifdef _WIN32
+        buffer_ = static_cast<std::byte*>(_aligned_malloc(capacity_, max_alignment));
+#else
+        buffer_ = static_cast<std::byte*>(std::aligned_alloc(max_alignment, capacity_));
+#endif
+        assert(buffer_ && "Failed to allocate ring buffer");
+    }
+
+    SpscRingAllocator::~SpscRingAllocator()
+    {
+        if (buffer_)
+        {
+#ifdef _WIN32
+            _aligned_free(buffer_);
+#else
+            std::free(buffer_);
+#endif
+        }
+    }
+
+    void* SpscRingAllocator::reserve(const std::size_t size, const std::size_t alignment) noexcept
+    {
+        assert(size > 0 && "Record size must be greater than zero");
+        assert((alignment & (alignment - 1)) == 0 && alignment <= max_alignment &&
+            "Alignment must be a power of 2 no larger than max_alignment");
+
+        const std::uint64_t head = head_.load(std::memory_order_relaxed);
+        assert(reserved_end_ == head && "Previous reservation not committed");
+
+        // Larger records could need more than the whole ring once a skip marker is added
+        if (size > max_record_size(alignment))
+        {
+            return nullptr;
+        }
+
+        // Lay the record out at the head
+        const std::size_t offset = head & mask_;
+        std::uint64_t start = head;
+        std::size_t data_offset = align_up(offset + header_size, alignment) - offset;
+        std::size_t length = align_up(data_offset + size, header_size);
+
+        if (offset + length > capacity_)
+        {
+            // Does not fit before the end: skip the remainder and start over at the front
+            start = head + (capacity_ - offset);
+            data_offset = align_up(header_size, alignment);
+            length = align_up(data_offset + size, header_size);
+        }
+
+        // Check space against the cached tail first; only re-read the consumer's line when short
+        const std::uint64_t end = start + length;
+        if (end - cached_tail_ > capacity_)
+        {
+            cached_tail_ = tail_.load(std::memory_order_acquire);
+            if (end - cached_tail_ > capacity_)
+            {
+                return nullptr;
+            }
+        }
+
+        if (start != head)
+        {
+            *header_at(head) = {static_cast<std::uint32_t>(start - head), 0, 0};
+        }
+
+        RecordHeader* header = header_at(start);
+        *header = {static_cast<std::uint32_t>(length), static_cast<std::uint32_t>(data_offset), size};
+
+        reserved_ = start;
+        reserved_end_ = end;
+
+        return reinterpret_cast<std::byte*>(header) + data_offset;
+    }
+
+    void SpscRingAllocator::commit() noexcept
+    {
+        assert(reserved_end_ != head_.load(std::memory_order_relaxed) && "No reservation to commit");
+
+        // Publishes the record and any skip marker in front of it
+        head_.store(reserved_end_, std::memory_order_release);
+    }
+
+    void SpscRingAllocator::commit(const std::size_t size) noexcept
+    {
+        assert(reserved_end_ != head_.load(std::memory_order_relaxed) && "No reservation to commit");
+
+        RecordHeader* header = header_at(reserved_);
+        assert(size <= header->size && "Cannot commit more than was reserved");
+
+        header->size = size;
+        header->length = static_cast<std::uint32_t>(align_up(header->offset + size, header_size));
+        reserved_end_ = reserved_ + header->length;
+
+        commit();
+    }
+
+    void* SpscRingAllocator::front(std::size_t* size) noexcept
+    {
+        std::uint64_t tail = tail_.load(std::memory_order_relaxed);
+
+        while (true)
+        {
+            if (tail == cached_head_)
+            {
+                cached_head_ = head_.load(std::memory_order_acquire);
+                if (tail == cached_head_)
+                {
+                    return nullptr;
+                }
+            }
+
+            const RecordHeader* header = header_at(tail);
+            if (header->offset != 0)
+            {
+                if (size)
+                {
+                    *size = static_cast<std::size_t>(header->size);
+                }
+                return buffer_ + (tail & mask_) + header->offset;
+            }
+
+            // Skip marker: hand the wasted tail of the buffer back to the producer
+            tail += header->length;
+            tail_.store(tail, std::memory_order_release);
+        }
+    }
+
+    void SpscRingAllocator::release() noexcept
+    {
+        const std::uint64_t tail = tail_.load(std::memory_order_relaxed);
+        assert(tail != cached_head_ && "No record to release");
+
+        tail_.store(tail + header_at(tail)->length, std::memory_order_release);
+    }
+} // namespace fast_alloc
@@ -0,0 +1,149 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace fast_alloc
+{
+    /**
+     * @brief Single-producer single-consumer ring of variable-size records.
+     *
+     * The producer reserve()s an aligned record at the head, writes it in place and commit()s
+     * it; the consumer reads committed records in order with front() and release()s them from
+     * the tail. Records are never copied and nothing is allocated after construction, so a
+     * message travels from one thread to the other through a single shared buffer.
+     *
+     * Every record starts with a 16-byte header. When a record does not fit before the end of
+     * the buffer, the producer writes a skip marker over the remainder and places the record at
+     * the start; the consumer steps over skip markers transparently. Records are limited to
+     * max_record_size(), about half the capacity, so that a record and the skip marker in front
+     * of it always fit once the consumer has caught up, wherever the head happens to be.
+     *
+     * Example:
+     * @code
+     * SpscRingAllocator ring(1 << 20);
+     * // Producer thread
+     * if (void* record = ring.reserve(max_line)) {
+     *     ring.commit(format_line(record, max_line)); // Commit only the bytes written
+     * }
+     * // Consumer thread
+     * std::size_t size;
+     * while (const void* record = ring.front(&size)) { ship(record, size); ring.release(); }
+     * @endcode
+     *
+     * @note Thread-safety: One producer thread (reserve/commit) and one consumer thread
+     *       (front/release) may run concurrently. Head and tail are atomics on separate cache
+     *       lines; each side keeps a cached copy of the other's position and only re-reads it
+     *       when the ring looks full or empty.
+     * @note Memory overhead: 16-byte header per record, plus padding to 16 bytes and alignment.
+     */
+    class SpscRingAllocator
+    {
+    public:
+        static constexpr std::size_t header_size = 16;    ///< Bytes in front of every record
+        static constexpr std::size_t max_alignment = 64;  ///< Largest supported record alignment
+
+        /**
+         * @brief Construct a ring.
+         *
+         * @param capacity Size in bytes of the ring buffer (power of 2, >= 64, < 4 GiB)
+         * @throws assert if capacity is invalid
+         */
+        explicit SpscRingAllocator(std::size_t capacity);
+        ~SpscRingAllocator();
+
+        // Pinned: the producer and consumer threads hold references
+        SpscRingAllocator(const SpscRingAllocator&) = delete;
+        SpscRingAllocator& operator=(const SpscRingAllocator&) = delete;
+
+        /**
+         * @brief Reserve a record at the head. Producer only.
+         *
+         * @param size Record size in bytes (must be > 0)
+         * @param alignment Record alignment (power of 2, <= max_alignment)
+         * @return Pointer to the record; nullptr if size exceeds max_record_size(alignment), or if
+         *         the ring lacks space (try again once the consumer has released records)
+         * @note Complexity: O(1)
+         * @warning The previous reservation must have been committed.
+         */
+        void* reserve(std::size_t size, std::size_t alignment = alignof(std::max_align_t)) noexcept;
+
+        /** @brief Publish the reserved record to the consumer. Producer only. */
+        void commit() noexcept;
+
+        /**
+         * @brief Publish the reserved record, trimmed to its first @p size bytes. Producer only.
+         * @param size Bytes actually written (<= the reserved size); the rest returns to the ring
+         */
+        void commit(std::size_t size) noexcept;
+
+        /**
+         * @brief Get the oldest committed record. Consumer only.
+         *
+         * @param[out] size Set to the record's size, if not nullptr
+         * @return Pointer to the record, or nullptr if none is committed
+         * @note Calling front() again without release() returns the same record.
+         */
+        [[nodiscard]] void* front(std::size_t* size = nullptr) noexcept;
+
+        /** @brief Release the record returned by front(), freeing its space. Consumer only. */
+        void release() noexcept;
+
+        /** @brief Get the capacity in bytes. */
+        [[nodiscard]] std::size_t capacity() const noexcept { return capacity_; }
+
+        /**
+         * @brief Get the largest record reserve() accepts at @p alignment.
+         *
+         * Half the capacity, less the header and alignment padding: the skip marker before a
+         * wrapped record is always shorter than the record, so both fit in an empty ring.
+         */
+        [[nodiscard]] std::size_t max_record_size(const std::size_t alignment = alignof(std::max_align_t)) const noexcept
+        {
+            return capacity_ / 2 - (alignment > header_size ? alignment : header_size);
+        }
+
+        /** @brief Get the bytes held by committed, unreleased records (approximate while in use). */
+        [[nodiscard]] std::size_t used() const noexcept
+        {
+            return static_cast<std::size_t>(head_.load(std::memory_order_acquire) -
+                                             tail_.load(std::memory_order_acquire));
+        }
+
+        /** @brief Check whether no committed record is waiting (approximate while in use). */
+        [[nodiscard]] bool empty() const noexcept { return used() == 0; }
+
+    private:
+        /**
+         * @brief Header at the start of every record.
+         */
+        struct RecordHeader
+        {
+            std::uint32_t length;   ///< Bytes from this header to the next record
+            std::uint32_t offset;   ///< Bytes from this header to the data; 0 marks a skip
+            std::uint64_t size;     ///< Bytes of data
+        };
+
+        static_assert(sizeof(RecordHeader) == header_size);
+
+        std::byte* buffer_;
+        std::size_t capacity_;
+        std::size_t mask_;
+
+        // Producer cache line
+        alignas(64) std::atomic<std::uint64_t> head_; ///< Position after the last committed record
+        std::uint64_t cached_tail_;   ///< Producer's last view of tail_
+        std::uint64_t reserved_;      ///< Position of the reserved record's header
+        std::uint64_t reserved_end_;  ///< Position after the reserved record; equals head_ when none
+
+        // Consumer cache line
+        alignas(64) std::atomic<std::uint64_t> tail_; ///< Position of the oldest unreleased record
+        std::uint64_t cached_head_;   ///< Consumer's last view of head_
+
+        [[nodiscard]] RecordHeader* header_at(std::uint64_t position) const noexcept
+        {
+            return reinterpret_cast<RecordHeader*>(buffer_ + (position & mask_));
+        }
+    };
+} // namespace fast_alloc
@@ -17,10 +17,14 @@ namespace fast_alloc
     {
         assert(size > 0 && "Stack size must be greater than zero");
 
+        // aligned_alloc requires a multiple of the alignment; the tail is never handed out
+        constexpr std::size_t alignment = alignof(std::max_align_t);
+        const std::size_t bytes = (size_ + alignment - 1) & ~(alignment - 1);
+
 #ifdef _WIN32
-        memory_ = _aligned_malloc(size_, alignof(std::max_align_t));
+        memory_ = _aligned_malloc(bytes, alignment);
 #else
-        memory_ = std::aligned_alloc(alignof(std::max_align_t), size_);
+        memory_ = std::aligned_alloc(alignment, bytes);
 #endif
         assert(memory_ && "Failed to allocate stack memory");
 
@@ -94,6 +98,25 @@ namespace fast_alloc
         return reinterpret_cast<void*>(aligned_address);
     }
 
+    bool StackAllocator::try_grow(void* ptr, const std::size_t old_size, const std::size_t new_size) noexcept
+    {
+        auto* const start = static_cast<std::byte*>(ptr);
+
+        // Only the allocation ending at the top of the stack can change size
+        if (!ptr || start + old_size != current_)
+        {
+            return false;
+        }
+
+        if (new_size > old_size && new_size - old_size > available())
+        {
+            return false;
+        }
+
+        current_ = start + new_size;
+        return true;
+    }
+
     void StackAllocator::reset(void* marker)
     {
         assert(memory_ && "Allocator not initialised");
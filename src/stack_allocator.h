@@ -55,6 +55,20 @@ namespace fast_alloc
          */
         void* allocate(std::size_t size, std::size_t alignment = alignof(std::max_align_t));
 
+        /**
+         * @brief Resize the most recent allocation in place.
+         *
+         * Succeeds only when [ptr, ptr + old_size) ends at the top of the stack - nothing was
+         * allocated after it - and the new size fits. Lets arena containers grow without copying.
+         *
+         * @param ptr Start of the allocation
+         * @param old_size Current size of the allocation in bytes
+         * @param new_size Requested size in bytes (may be smaller)
+         * @return true if the allocation now spans new_size bytes; false leaves it unchanged
+         * @note Complexity: O(1)
+         */
+        bool try_grow(void* ptr, std::size_t old_size, std::size_t new_size) noexcept;
+
         /**
          * @brief Reset allocator to a previous state or to the beginning.
          * 
@@ -82,6 +96,9 @@ namespace fast_alloc
         /** @brief Get total capacity in bytes. */
         [[nodiscard]] std::size_t capacity() const noexcept { return size_; }
 
+        /** @brief Get the start of the stack memory (capacity() bytes). */
+        [[nodiscard]] void* data() const noexcept { return memory_; }
+
         /** @brief Get currently used bytes. */
         [[nodiscard]] std::size_t used() const noexcept;
 
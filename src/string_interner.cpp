@@ -0,0 +1,169 @@
+#include "string_interner.h"
+
+#include <cassert>
+#include <cstring>
+#include <utility>
+
+namespace fast_alloc
+{
+    StringInterner::StringInterner(const std::size_t page_size, const std::size_t expected_strings)
+        : page_size_(page_size)
+          , current_page_(0)
+          , bytes_used_(0)
+    {
+        assert(page_size > 0 && "Page size must be greater than zero");
+
+        // Keep the load factor at or below one half
+        std::size_t capacity = 16;
+        while (capacity < expected_strings * 2)
+        {
+            capacity *= 2;
+        }
+
+        slots_.assign(capacity, Slot{0, invalid_id});
+        entries_.reserve(expected_strings);
+        pages_.emplace_back(page_size_);
+    }
+
+    StringId StringInterner::intern(const std::string_view string)
+    {
+        assert(string.size() < UINT32_MAX && "String too long to intern");
+
+        const std::uint32_t string_hash = hash(string);
+        std::size_t slot = probe(string, string_hash);
+
+        if (slots_[slot].id != invalid_id)
+        {
+            return slots_[slot].id; // Already interned
+        }
+
+        if ((entries_.size() + 1) * 2 > slots_.size())
+        {
+            grow();
+            slot = probe(string, string_hash);
+        }
+
+        const auto id = static_cast<StringId>(entries_.size());
+        assert(id != invalid_id && "String id space exhausted");
+
+        entries_.push_back({store(string), static_cast<std::uint32_t>(string.size()), string_hash});
+        slots_[slot] = {string_hash, id};
+
+        return id;
+    }
+
+    StringId StringInterner::find(const std::string_view string) const noexcept
+    {
+        return slots_[probe(string, hash(string))].id;
+    }
+
+    std::string_view StringInterner::view(const StringId id) const noexcept
+    {
+        assert(id < entries_.size() && "Invalid string id");
+
+        const Entry& entry = entries_[id];
+        return {entry.data, entry.length};
+    }
+
+    void StringInterner::clear() noexcept
+    {
+        for (auto& page : pages_)
+        {
+            page.reset();
+        }
+
+        for (auto& slot : slots_)
+        {
+            slot = {0, invalid_id};
+        }
+
+        entries_.clear();
+        current_page_ = 0;
+        bytes_used_ = 0;
+    }
+
+    std::uint32_t StringInterner::hash(const std::string_view string) noexcept
+    {
+        std::uint64_t value = 14695981039346656037ull;
+        for (const char c : string)
+        {
+            value ^= static_cast<unsigned char>(c);
+            value *= 1099511628211ull;
+        }
+
+        return static_cast<std::uint32_t>(value ^ (value >> 32));
+    }
+
+    std::size_t StringInterner::probe(const std::string_view string, const std::uint32_t hash) const noexcept
+    {
+        const std::size_t mask = slots_.size() - 1;
+
+        // Linear probing - the table is never full, so an empty slot always ends the search
+        for (std::size_t slot = hash & mask;; slot = (slot + 1) & mask)
+        {
+            const Slot& candidate = slots_[slot];
+            if (candidate.id == invalid_id)
+            {
+                return slot;
+            }
+
+            if (candidate.hash == hash)
+            {
+                const Entry& entry = entries_[candidate.id];
+                if (std::string_view(entry.data, entry.length) == string)
+                {
+                    return slot;
+                }
+            }
+        }
+    }
+
+    const char* StringInterner::store(const std::string_view string)
+    {
+        const std::size_t bytes = string.size() + 1;
+        void* memory = pages_[current_page_].allocate(bytes, 1);
+
+        // Move on to the next retained page, or add a new one
+        while (!memory && bytes <= page_size_)
+        {
+            if (++current_page_ == pages_.size())
+            {
+                pages_.emplace_back(page_size_);
+            }
+            memory = pages_[current_page_].allocate(bytes, 1);
+        }
+
+        if (!memory)
+        {
+            // Oversized string - a page of its own, sized to fit. It joins the chain like any
+            // other page, so after clear() or once current_page_ reaches it, it is bumped into
+            pages_.emplace_back(bytes);
+            memory = pages_.back().allocate(bytes, 1);
+        }
+
+        auto* data = static_cast<char*>(memory);
+        std::memcpy(data, string.data(), string.size());
+        data[string.size()] = '\0';
+        bytes_used_ += bytes;
+
+        return data;
+    }
+
+    void StringInterner::grow()
+    {
+        std::vector<Slot> slots(slots_.size() * 2, Slot{0, invalid_id});
+        const std::size_t mask = slots.size() - 1;
+
+        for (StringId id = 0; id < entries_.size(); ++id)
+        {
+            std::size_t slot = entries_[id].hash & mask;
+            while (slots[slot].id != invalid_id)
+            {
+                slot = (slot + 1) & mask;
+            }
+            slots[slot] = {entries_[id].hash, id};
+        }
+
+        slots_ = std::move(slots);
+    }
+} // namespace fast_alloc
@@ -0,0 +1,127 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+#include "stack_allocator.h"
+
+namespace fast_alloc
+{
+    /** @brief Compact handle to an interned string. Equal strings always get equal ids. */
+    using StringId = std::uint32_t;
+
+    /**
+     * @brief String arena that stores each distinct string once and hands out 32-bit ids.
+     *
+     * String bytes are bump-allocated into a chain of StackAllocator pages and never move, so
+     * view() returns a zero-copy std::string_view that stays valid until clear(). An
+     * open-addressing hash table of (hash, id) slots deduplicates strings, so comparing two
+     * interned strings is a single integer comparison.
+     *
+     * Ideal for: log and metric labels, identifiers, asset paths, any hot path that sees the
+     * same strings millions of times.
+     *
+     * @note Thread-safety: Not thread-safe.
+     * @note Memory overhead: 1 terminator byte per string, 16 bytes per entry, 8 bytes per table slot.
+     * @note Strings are NUL-terminated in the arena, so view(id).data() can be passed to C APIs.
+     */
+    class StringInterner
+    {
+    public:
+        static constexpr StringId invalid_id = UINT32_MAX; ///< Returned by find() for unknown strings
+
+        /**
+         * @brief Construct a string interner.
+         *
+         * @param page_size Bytes per arena page. Longer strings get a page sized to fit them.
+         * @param expected_strings Number of distinct strings to size the hash table for
+         * @throws assert if page_size == 0
+         */
+        explicit StringInterner(std::size_t page_size = 64 * 1024, std::size_t expected_strings = 1024);
+
+        // Disable copy
+        StringInterner(const StringInterner&) = delete;
+        StringInterner& operator=(const StringInterner&) = delete;
+
+        // Enable move
+        StringInterner(StringInterner&& other) noexcept = default;
+        StringInterner& operator=(StringInterner&& other) noexcept = default;
+
+        /**
+         * @brief Get the id of a string, storing it on first sight.
+         *
+         * @param string String to intern (copied into the arena the first time)
+         * @return Id of the string
+         * @note Complexity: O(length) expected - one hash plus, on a hit, one comparison
+         */
+        StringId intern(std::string_view string);
+
+        /**
+         * @brief Get the id of a string without storing it.
+         *
+         * @return Id of the string, or invalid_id if it has never been interned.
+         */
+        [[nodiscard]] StringId find(std::string_view string) const noexcept;
+
+        /**
+         * @brief Get the bytes of an interned string.
+         *
+         * @param id Id returned by intern() (must be < size())
+         * @note Complexity: O(1), no copy
+         */
+        [[nodiscard]] std::string_view view(StringId id) const noexcept;
+
+        /** @brief Drop every string and id. Pages are kept for reuse. */
+        void clear() noexcept;
+
+        /** @brief Get the number of distinct strings. */
+        [[nodiscard]] std::size_t size() const noexcept { return entries_.size(); }
+
+        /** @brief Get the number of arena pages. */
+        [[nodiscard]] std::size_t page_count() const noexcept { return pages_.size(); }
+
+        /** @brief Get the bytes of string data stored (including terminators). */
+        [[nodiscard]] std::size_t bytes_used() const noexcept { return bytes_used_; }
+
+    private:
+        /**
+         * @brief Location of one interned string.
+         */
+        struct Entry
+        {
+            const char* data;     ///< First byte in the arena
+            std::uint32_t length; ///< Length excluding terminator
+            std::uint32_t hash;   ///< Cached hash for rehashing
+        };
+
+        /**
+         * @brief Hash table slot. Storing the hash lets probes skip most string comparisons.
+         */
+        struct Slot
+        {
+            std::uint32_t hash; ///< Hash of the string
+            StringId id;        ///< Entry index, or invalid_id when empty
+        };
+
+        std::size_t page_size_;
+        std::size_t current_page_;     ///< Page that small strings are bumped into
+        std::size_t bytes_used_;
+        std::vector<StackAllocator> pages_;
+        std::vector<Entry> entries_;
+        std::vector<Slot> slots_;      ///< Power-of-2 sized, at most half full
+
+        /** @brief FNV-1a hash folded to 32 bits. */
+        [[nodiscard]] static std::uint32_t hash(std::string_view string) noexcept;
+
+        /** @brief Find the slot holding @p string, or the empty slot where it belongs. */
+        [[nodiscard]] std::size_t probe(std::string_view string, std::uint32_t hash) const noexcept;
+
+        /** @brief Copy @p string into the arena, adding pages as needed. */
+        const char* store(std::string_view string);
+
+        /** @brief Double the table and reinsert every entry from its cached hash. */
+        void grow();
+    };
+} // namespace fast_alloc
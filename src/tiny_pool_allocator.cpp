@@ -0,0 +1,157 @@
+#include "tiny_pool_allocator.h"
+
+#include <bit>
+#include <cassert>
+#include <utility>
+
+#ifdef _WIN32
+#include <malloc.h>
+#else
+#include <cstdlib>
+#endif
+
+namespace fast_alloc
+{
+    TinyPoolAllocator::TinyPoolAllocator(const std::size_t block_size, const std::size_t block_count)
+        : block_size_(block_size)
+          , block_count_(block_count)
+          , allocated_count_(0)
+          , search_hint_(0)
+          , memory_(nullptr)
+          , free_bits_((block_count + 63) / 64, ~std::uint64_t{0})
+    {
+        assert(block_size > 0 && "Block size must be greater than zero");
+        assert(block_count > 0 && "Block count must be greater than zero");
+
+        // aligned_alloc needs a size that is a multiple of the alignment
+        constexpr std::size_t alignment = alignof(std::max_align_t);
+        const std::size_t bytes = (block_size_ * block_count_ + alignment - 1) & ~(alignment - 1);
+
+#ifdef _WIN32
+        memory_ = _aligned_malloc(bytes, alignment);
+#else
+        memory_ = std::aligned_alloc(alignment, bytes);
+#endif
+        assert(memory_ && "Failed to allocate memory pool");
+
+        // Clear the bits past the last block so they are never handed out
+        if (const std::size_t tail = block_count_ % 64; tail != 0)
+        {
+            free_bits_.back() = (std::uint64_t{1} << tail) - 1;
+        }
+    }
+
+    TinyPoolAllocator::~TinyPoolAllocator()
+    {
+        if (memory_)
+        {
+#ifdef _WIN32
+            _aligned_free(memory_);
+#else
+            std::free(memory_);
+#endif
+        }
+    }
+
+    TinyPoolAllocator::TinyPoolAllocator(TinyPoolAllocator&& other) noexcept
+        : block_size_(other.block_size_)
+          , block_count_(other.block_count_)
+          , allocated_count_(other.allocated_count_)
+          , search_hint_(other.search_hint_)
+          , memory_(other.memory_)
+          , free_bits_(std::move(other.free_bits_))
+    {
+        other.memory_ = nullptr;
+        other.allocated_count_ = 0;
+        other.block_count_ = 0;
+        other.search_hint_ = 0;
+    }
+
+    TinyPoolAllocator& TinyPoolAllocator::operator=(TinyPoolAllocator&& other) noexcept
+    {
+        if (this != &other)
+        {
+            if (memory_)
+            {
+#ifdef _WIN32
+                _aligned_free(memory_);
+#else
+                std::free(memory_);
+#endif
+            }
+
+            block_size_ = other.block_size_;
+            block_count_ = other.block_count_;
+            allocated_count_ = other.allocated_count_;
+            search_hint_ = other.search_hint_;
+            memory_ = other.memory_;
+            free_bits_ = std::move(other.free_bits_);
+
+            other.memory_ = nullptr;
+            other.allocated_count_ = 0;
+            other.block_count_ = 0;
+            other.search_hint_ = 0;
+        }
+        return *this;
+    }
+
+    void* TinyPoolAllocator::allocate()
+    {
+        if (allocated_count_ >= block_count_)
+        {
+            return nullptr; // Pool exhausted
+        }
+
+        // Every word below the hint is full, so the scan never revisits them
+        while (free_bits_[search_hint_] == 0)
+        {
+            ++search_hint_;
+        }
+
+        std::uint64_t& word = free_bits_[search_hint_];
+        const auto bit = static_cast<std::size_t>(std::countr_zero(word));
+        word &= word - 1; // Clear lowest set bit
+        ++allocated_count_;
+
+        const std::size_t index = search_hint_ * 64 + bit;
+        return static_cast<std::byte*>(memory_) + index * block_size_;
+    }
+
+    void TinyPoolAllocator::deallocate(void* ptr)
+    {
+        if (!ptr)
+        {
+            return;
+        }
+
+        assert(allocated_count_ > 0 && "Deallocating from empty pool");
+
+        // Validate pointer is within our memory range
+        const auto ptr_address = reinterpret_cast<std::size_t>(ptr);
+        const auto memory_start = reinterpret_cast<std::size_t>(memory_);
+        const auto memory_end = memory_start + (block_size_ * block_count_);
+
+        assert(ptr_address >= memory_start && ptr_address < memory_end
+            && "Pointer outside pool memory range");
+
+        // Validate pointer is properly aligned to a block boundary
+        assert((ptr_address - memory_start) % block_size_ == 0
+            && "Pointer not aligned to block boundary");
+
+        // Suppress unused variable warnings in release builds
+        (void)memory_end;
+
+        const std::size_t index = (ptr_address - memory_start) / block_size_;
+        const std::size_t word = index / 64;
+        const std::uint64_t mask = std::uint64_t{1} << (index % 64);
+
+        assert((free_bits_[word] & mask) == 0 && "Double free detected");
+
+        free_bits_[word] |= mask;
+        if (word < search_hint_)
+        {
+            search_hint_ = word;
+        }
+        --allocated_count_;
+    }
+} // namespace fast_alloc
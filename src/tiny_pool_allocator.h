@@ -0,0 +1,84 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace fast_alloc
+{
+    /**
+     * @brief Fixed-size pool for objects smaller than a pointer.
+     *
+     * PoolAllocator stores its free list inside free blocks, so every block must hold a pointer.
+     * TinyPoolAllocator instead tracks free blocks in a side bitmap (one bit per block), so blocks
+     * of any size >= 1 byte are packed densely with no padding. Ideal for small ids, packed flags,
+     * and millions of 2-6 byte records.
+     *
+     * @note Thread-safety: Not thread-safe.
+     * @note Memory overhead: 1 bit per block (free bitmap), never stored in the blocks.
+     * @note Fragmentation: None (all blocks same size).
+     * @note Allocation order: Lowest free address first, which keeps live blocks clustered.
+     *
+     * @warning Blocks are packed at block_size stride, so they are only aligned to the largest
+     *          power of 2 dividing block_size. Access multi-byte fields with std::memcpy.
+     */
+    class TinyPoolAllocator
+    {
+    public:
+        /**
+         * @brief Construct a tiny pool allocator.
+         *
+         * @param block_size Size in bytes of each block (must be >= 1)
+         * @param block_count Number of blocks to allocate
+         * @throws assert if block_size == 0 or block_count == 0
+         */
+        TinyPoolAllocator(std::size_t block_size, std::size_t block_count);
+        ~TinyPoolAllocator();
+
+        // Disable copy
+        TinyPoolAllocator(const TinyPoolAllocator&) = delete;
+        TinyPoolAllocator& operator=(const TinyPoolAllocator&) = delete;
+
+        // Enable move
+        TinyPoolAllocator(TinyPoolAllocator&& other) noexcept;
+        TinyPoolAllocator& operator=(TinyPoolAllocator&& other) noexcept;
+
+        /**
+         * @brief Allocate a single block from the pool.
+         *
+         * @return Pointer to allocated block, or nullptr if pool is exhausted.
+         * @note Complexity: O(1) while frees are sequential; worst case O(capacity / 64) - scans the
+         *       bitmap a word (64 blocks) at a time from a search hint that deallocate() lowers
+         */
+        void* allocate();
+
+        /**
+         * @brief Return a block to the pool.
+         *
+         * @param ptr Pointer to block (must be from this allocator). nullptr is safely ignored.
+         * @note Complexity: O(1) - sets one bit, never writes to the block
+         * @warning Passing invalid pointers will trigger assertions in debug builds.
+         */
+        void deallocate(void* ptr);
+
+        /** @brief Get the size of each block in bytes. */
+        [[nodiscard]] std::size_t block_size() const noexcept { return block_size_; }
+
+        /** @brief Get the total capacity (number of blocks). */
+        [[nodiscard]] std::size_t capacity() const noexcept { return block_count_; }
+
+        /** @brief Get the number of currently allocated blocks. */
+        [[nodiscard]] std::size_t allocated() const noexcept { return allocated_count_; }
+
+        /** @brief Check if the pool is full (no blocks available). */
+        [[nodiscard]] bool is_full() const noexcept { return allocated_count_ >= block_count_; }
+
+    private:
+        std::size_t block_size_;
+        std::size_t block_count_;
+        std::size_t allocated_count_;
+        std::size_t search_hint_;           ///< Lowest bitmap word that may hold a free bit
+        void* memory_;
+        std::vector<std::uint64_t> free_bits_; ///< Bit set = block free
+    };
+} // namespace fast_alloc
@@ -0,0 +1,125 @@
+#include <catch2/catch_test_macros.hpp>
+#include "allocator_concept.h"
+#include "allocator_context.h"
+#include "binned_arena_allocator.h"
+#include "freelist_allocator.h"
+#include "memory_budget.h"
+#include "pool_allocator.h"
+#include "stack_allocator.h"
+#include "threadsafe_pool_allocator.h"
+#include "tiny_pool_allocator.h"
+#include <cstdint>
+
+using namespace fast_alloc;
+
+namespace
+{
+    /** @brief Generic code written once against the concept. */
+    template <Allocator A>
+    std::uint64_t* make_counter(A& allocator, const std::uint64_t value)
+    {
+        void* memory = fast_alloc::allocate(allocator, sizeof(std::uint64_t), alignof(std::uint64_t));
+        return memory ? new (memory) std::uint64_t(value) : nullptr;
+    }
+
+    template <Allocator A>
+    void destroy_counter(A& allocator, std::uint64_t* counter)
+    {
+        fast_alloc::deallocate(allocator, counter, sizeof(std::uint64_t), alignof(std::uint64_t));
+    }
+
+    struct NotAnAllocator
+    {
+        void* allocate(std::size_t size);
+    };
+}
+
+TEST_CASE("Every allocator satisfies the Allocator concept", "[allocator_concept]")
+{
+    STATIC_REQUIRE(BlockAllocator<PoolAllocator>);
+    STATIC_REQUIRE(BlockAllocator<ThreadSafePoolAllocator>);
+    STATIC_REQUIRE(BlockAllocator<LeanPoolAllocator>);
+    STATIC_REQUIRE(BlockAllocator<CheckedPoolAllocator>);
+    STATIC_REQUIRE(BlockAllocator<TinyPoolAllocator>);
+
+    STATIC_REQUIRE(SizedAllocator<StackAllocator>);
+    STATIC_REQUIRE(SizedAllocator<BinnedArenaAllocator>);
+    STATIC_REQUIRE(SizedAllocator<FreeListAllocator>);
+    STATIC_REQUIRE(SizedAllocator<BudgetedAllocator<PoolAllocator>>);
+    STATIC_REQUIRE(SizedAllocator<AllocatorHandle>);
+
+    STATIC_REQUIRE_FALSE(Allocator<NotAnAllocator>);
+    STATIC_REQUIRE_FALSE(Allocator<int>);
+}
+
+TEST_CASE("Generic allocate and deallocate dispatch by shape", "[allocator_concept]")
+{
+    SECTION("Pool")
+    {
+        PoolAllocator pool(sizeof(std::uint64_t), 2);
+        std::uint64_t* counter = make_counter(pool, 7);
+        REQUIRE(counter != nullptr);
+        REQUIRE(*counter == 7);
+        REQUIRE(pool.allocated() == 1);
+
+        // Larger or more aligned than a block
+        REQUIRE(fast_alloc::allocate(pool, 16) == nullptr);
+        REQUIRE(fast_alloc::allocate(pool, 8, 64) == nullptr);
+
+        destroy_counter(pool, counter);
+        REQUIRE(pool.allocated() == 0);
+    }
+
+    SECTION("Tiny pool guarantees the alignment its stride allows")
+    {
+        TinyPoolAllocator tiny(12, 8);
+        REQUIRE(block_alignment(tiny) == 4);
+        REQUIRE(fast_alloc::allocate(tiny, 12, 8) == nullptr);
+
+        void* block = fast_alloc::allocate(tiny, 12, 4);
+        REQUIRE(block != nullptr);
+        REQUIRE(tiny.allocated() == 1);
+        fast_alloc::deallocate(tiny, block, 12, 4);
+        REQUIRE(tiny.allocated() == 0);
+    }
+
+    SECTION("Arena")
+    {
+        StackAllocator stack(256);
+        std::uint64_t* counter = make_counter(stack, 9);
+        REQUIRE(*counter == 9);
+        destroy_counter(stack, counter); // No-op; freed by reset()
+        REQUIRE(stack.used() >= sizeof(std::uint64_t));
+    }
+
+    SECTION("Sized deallocation")
+    {
+        BinnedArenaAllocator arena(4096);
+        std::uint64_t* counter = make_counter(arena, 11);
+        destroy_counter(arena, counter);
+
+        // The freed bin is reused for the next allocation of the same size
+        REQUIRE(make_counter(arena, 12) == counter);
+    }
+
+    SECTION("Free list")
+    {
+        FreeListAllocator heap(1024);
+        std::uint64_t* counter = make_counter(heap, 13);
+        REQUIRE(*counter == 13);
+        destroy_counter(heap, counter);
+        REQUIRE(heap.used() == 0);
+    }
+
+    SECTION("Type-erased through a handle")
+    {
+        PoolAllocator pool(sizeof(std::uint64_t), 1);
+        AllocatorHandle handle = AllocatorHandle::of(pool);
+
+        std::uint64_t* counter = make_counter(handle, 21);
+        REQUIRE(counter != nullptr);
+        REQUIRE(pool.is_full());
+        destroy_counter(handle, counter);
+        REQUIRE(pool.allocated() == 0);
+    }
+}
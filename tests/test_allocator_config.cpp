@@ -0,0 +1,221 @@
+#include <catch2/catch_test_macros.hpp>
+#include "pool_allocator.h"
+#include "threadsafe_pool_allocator.h"
+#include <csignal>
+#include <cstdint>
+#include <cstdio>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#ifdef __linux__
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+using namespace fast_alloc;
+
+namespace
+{
+    struct PagePoolConfig : PoolConfig
+    {
+        using Backend = PageBackend;
+        static constexpr std::size_t alignment = 64;
+    };
+
+    struct LockedLeanPoolConfig : LeanPoolConfig
+    {
+        static constexpr bool thread_safe = true;
+    };
+
+    template <typename Pool>
+    concept HasStatistics = requires(const Pool& pool) { pool.allocated(); };
+}
+
+TEST_CASE("Pool configurations select features at compile time", "[config]")
+{
+    STATIC_REQUIRE(HasStatistics<PoolAllocator>);
+    STATIC_REQUIRE(HasStatistics<ThreadSafePoolAllocator>);
+    STATIC_REQUIRE_FALSE(HasStatistics<LeanPoolAllocator>);
+
+    STATIC_REQUIRE(std::is_move_constructible_v<PoolAllocator>);
+    STATIC_REQUIRE(std::is_move_constructible_v<LeanPoolAllocator>);
+    STATIC_REQUIRE_FALSE(std::is_move_constructible_v<ThreadSafePoolAllocator>);
+    STATIC_REQUIRE_FALSE(std::is_move_assignable_v<ThreadSafePoolAllocator>);
+
+    // Compiled-out features leave no data members behind
+    STATIC_REQUIRE(sizeof(LeanPoolAllocator) < sizeof(PoolAllocator));
+    STATIC_REQUIRE(sizeof(PoolAllocator) == sizeof(CheckedPoolAllocator)); // Checks reuse the free-block bitmap
+    STATIC_REQUIRE(sizeof(PoolAllocator) < sizeof(ThreadSafePoolAllocator));
+}
+
+TEST_CASE("LeanPoolAllocator allocates without statistics", "[config]")
+{
+    LeanPoolAllocator pool(32, 4);
+
+    std::vector<void*> blocks;
+    while (!pool.is_full())
+    {
+        blocks.push_back(pool.allocate());
+        REQUIRE(blocks.back() != nullptr);
+    }
+
+    REQUIRE(blocks.size() == 4);
+    REQUIRE(pool.allocate() == nullptr);
+
+    pool.deallocate(blocks.back());
+    REQUIRE_FALSE(pool.is_full());
+    REQUIRE(pool.allocate() == blocks.back());
+
+    SECTION("Out-of-band tracking")
+    {
+        LeanPoolAllocator tiny(4, 2, alignof(void*), FreeSlotTracking::OutOfBand);
+        void* a = tiny.allocate();
+        void* b = tiny.allocate();
+        REQUIRE(tiny.is_full());
+
+        tiny.deallocate(a);
+        REQUIRE_FALSE(tiny.is_full());
+        tiny.deallocate(b);
+    }
+
+    SECTION("Contiguous runs")
+    {
+        LeanPoolAllocator runs(16, 8);
+        void* run = runs.allocate_contiguous(8);
+        REQUIRE(run != nullptr);
+        REQUIRE(runs.is_full());
+        REQUIRE(runs.allocate_contiguous(2) == nullptr);
+
+        runs.deallocate_contiguous(run, 8);
+        REQUIRE_FALSE(runs.is_full());
+    }
+}
+
+TEST_CASE("CheckedPoolAllocator tracks live blocks", "[config]")
+{
+    CheckedPoolAllocator pool(64, 16);
+
+    void* a = pool.allocate();
+    void* run = pool.allocate_contiguous(4);
+    REQUIRE(a != nullptr);
+    REQUIRE(run != nullptr);
+    REQUIRE(pool.allocated() == 5);
+
+    pool.deallocate_contiguous(run, 4);
+    pool.deallocate(a);
+    REQUIRE(pool.allocated() == 0);
+
+    SECTION("Move keeps the live set")
+    {
+        void* b = pool.allocate();
+        CheckedPoolAllocator moved(std::move(pool));
+        moved.deallocate(b);
+        REQUIRE(moved.allocated() == 0);
+    }
+}
+
+#ifdef __linux__
+TEST_CASE("CheckedPoolAllocator aborts on invalid frees", "[config]")
+{
+    CheckedPoolAllocator pool(64, 16);
+    void* block = pool.allocate();
+
+    const auto expect_abort = [](auto&& misuse)
+    {
+        const pid_t child = fork();
+        REQUIRE(child >= 0);
+
+        if (child == 0)
+        {
+            // Die of the abort itself: no Catch signal handler, and no report from the child
+            std::signal(SIGABRT, SIG_DFL);
+            std::freopen("/dev/null", "w", stdout);
+            std::freopen("/dev/null", "w", stderr);
+            misuse();
+            _exit(0);
+        }
+
+        int status = 0;
+        waitpid(child, &status, 0);
+        REQUIRE(WIFSIGNALED(status));
+        REQUIRE(WTERMSIG(status) == SIGABRT);
+    };
+
+    SECTION("Double free")
+    {
+        expect_abort([&] { pool.deallocate(block); pool.deallocate(block); });
+    }
+
+    SECTION("Pointer outside the pool")
+    {
+        int local = 0;
+        expect_abort([&] { pool.deallocate(&local); });
+    }
+
+    SECTION("Pointer inside a block")
+    {
+        expect_abort([&] { pool.deallocate(static_cast<std::byte*>(block) + 8); });
+    }
+
+    pool.deallocate(block);
+}
+#endif
+
+TEST_CASE("Page backend maps zeroed, page-aligned memory", "[config]")
+{
+    BasicPoolAllocator<PagePoolConfig> pool(100, 64, PagePoolConfig::alignment, FreeSlotTracking::OutOfBand);
+
+    REQUIRE(pool.alignment() == 64);
+    REQUIRE(pool.block_stride() == 128);
+    REQUIRE(reinterpret_cast<std::uintptr_t>(pool.data()) % 4096 == 0);
+
+    // Out-of-band tracking never writes block memory, so it is still as mapped
+    const auto* bytes = static_cast<const unsigned char*>(pool.data());
+    bool zeroed = true;
+    for (std::size_t i = 0; i < pool.block_stride() * pool.capacity(); ++i)
+    {
+        zeroed = zeroed && bytes[i] == 0;
+    }
+    REQUIRE(zeroed);
+
+    void* block = pool.allocate();
+    REQUIRE(block == pool.data());
+    pool.deallocate(block);
+}
+
+TEST_CASE("Thread-safe config without statistics", "[config]")
+{
+    BasicPoolAllocator<LockedLeanPoolConfig> pool(64, 4 * 1000);
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t)
+    {
+        threads.emplace_back([&pool]
+        {
+            std::vector<void*> blocks;
+            for (int i = 0; i < 1000; ++i)
+            {
+                blocks.push_back(pool.allocate());
+            }
+            for (void* block : blocks)
+            {
+                pool.deallocate(block);
+            }
+        });
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    // Every block came back, so the pool can be drained exactly once more
+    std::size_t count = 0;
+    while (pool.allocate())
+    {
+        ++count;
+    }
+    REQUIRE(count == 4 * 1000);
+    REQUIRE(pool.is_full());
+}
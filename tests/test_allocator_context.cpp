@@ -0,0 +1,130 @@
+#include <catch2/catch_test_macros.hpp>
+#include "allocator_context.h"
+#include "binned_arena_allocator.h"
+#include "freelist_allocator.h"
+#include "pool_allocator.h"
+#include "stack_allocator.h"
+#include <thread>
+#include <vector>
+
+using namespace fast_alloc;
+
+TEST_CASE("Allocator context defaults to the heap", "[allocator_context]")
+{
+    REQUIRE(current() == heap_allocator());
+
+    void* ptr = context_allocate(64, 64);
+    REQUIRE(ptr != nullptr);
+    REQUIRE(reinterpret_cast<std::uintptr_t>(ptr) % 64 == 0);
+    context_deallocate(ptr, 64, 64);
+}
+
+TEST_CASE("AllocatorScope routes allocations and nests", "[allocator_context]")
+{
+    StackAllocator outer_arena(1024);
+    StackAllocator inner_arena(1024);
+
+    {
+        AllocatorScope outer(outer_arena);
+        REQUIRE(context_allocate(100) != nullptr);
+        REQUIRE(outer_arena.used() >= 100);
+
+        {
+            AllocatorScope inner(inner_arena);
+            REQUIRE(context_allocate(200) != nullptr);
+            REQUIRE(inner_arena.used() >= 200);
+            REQUIRE(outer_arena.used() < 200);
+        }
+
+        // Popping the inner scope restores the outer arena
+        const std::size_t before = outer_arena.used();
+        REQUIRE(context_allocate(50) != nullptr);
+        REQUIRE(outer_arena.used() > before);
+    }
+
+    REQUIRE(current() == heap_allocator());
+}
+
+TEST_CASE("AllocatorScope is per thread", "[allocator_context]")
+{
+    StackAllocator arena(1024);
+    AllocatorScope scope(arena);
+
+    bool other_thread_on_heap = false;
+    std::thread worker([&] { other_thread_on_heap = current() == heap_allocator(); });
+    worker.join();
+
+    REQUIRE(other_thread_on_heap);
+    REQUIRE_FALSE(current() == heap_allocator());
+}
+
+TEST_CASE("AllocatorHandle adapts every allocator shape", "[allocator_context]")
+{
+    SECTION("Pool rejects oversized requests")
+    {
+        PoolAllocator pool(64, 4);
+        const AllocatorHandle handle = AllocatorHandle::of(pool);
+
+        void* ptr = handle.allocate(48);
+        REQUIRE(ptr != nullptr);
+        REQUIRE(pool.allocated() == 1);
+        REQUIRE(handle.allocate(65) == nullptr);
+
+        handle.deallocate(ptr, 48);
+        REQUIRE(pool.allocated() == 0);
+    }
+
+    SECTION("Free list frees by pointer")
+    {
+        FreeListAllocator list(4096);
+        const AllocatorHandle handle = AllocatorHandle::of(list);
+
+        void* ptr = handle.allocate(256);
+        REQUIRE(list.num_allocations() == 1);
+        handle.deallocate(ptr, 256);
+        REQUIRE(list.num_allocations() == 0);
+    }
+
+    SECTION("Binned arena receives the size back")
+    {
+        BinnedArenaAllocator binned(4096);
+        const AllocatorHandle handle = AllocatorHandle::of(binned);
+
+        void* first = handle.allocate(100);
+        handle.allocate(16); // Keep first from being the top allocation
+        handle.deallocate(first, 100);
+        REQUIRE(handle.allocate(100) == first);
+    }
+}
+
+TEST_CASE("ContextAllocator binds containers to the scope", "[allocator_context]")
+{
+    StackAllocator arena(64 * 1024);
+
+    std::vector<int, ContextAllocator<int>>* escaped = nullptr;
+    {
+        AllocatorScope scope(arena);
+        escaped = new std::vector<int, ContextAllocator<int>>();
+        escaped->reserve(16);
+    }
+
+    // Growing after the scope ends still uses the arena it was bound to
+    const std::size_t before = arena.used();
+    for (int i = 0; i < 1000; ++i)
+    {
+        escaped->push_back(i);
+    }
+    REQUIRE(arena.used() > before);
+    REQUIRE((*escaped)[999] == 999);
+
+    delete escaped;
+}
+
+TEST_CASE("ContextAllocator throws when the arena is exhausted", "[allocator_context]")
+{
+    StackAllocator arena(256);
+    AllocatorScope scope(arena);
+
+    std::vector<int, ContextAllocator<int>> values;
+    REQUIRE_THROWS_AS(values.reserve(1000), std::bad_alloc);
+}
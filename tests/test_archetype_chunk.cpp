@@ -0,0 +1,141 @@
+#include <catch2/catch_test_macros.hpp>
+#include "archetype_chunk_allocator.h"
+#include <cstdint>
+
+using namespace fast_alloc;
+
+namespace
+{
+    struct Position
+    {
+        float x, y, z;
+    };
+
+    struct Velocity
+    {
+        float x, y, z;
+    };
+
+    struct alignas(32) Transform
+    {
+        float m[8];
+    };
+}
+
+TEST_CASE("ArchetypeChunkAllocator layout", "[archetype]")
+{
+    const ArchetypeChunkAllocator archetype(
+        {component_layout<Position>(), component_layout<Velocity>(), component_layout<std::uint32_t>()}, 4);
+
+    REQUIRE(archetype.component_count() == 3);
+    REQUIRE(archetype.size() == 0);
+    REQUIRE(archetype.chunk_count() == 0);
+
+    // 28 bytes per entity plus at most one column alignment of padding per column
+    constexpr std::size_t bytes_per_entity = sizeof(Position) + sizeof(Velocity) + sizeof(std::uint32_t);
+    const std::size_t per_chunk = archetype.entities_per_chunk();
+    REQUIRE(per_chunk * bytes_per_entity <= ArchetypeChunkAllocator::chunk_size);
+    REQUIRE(per_chunk >= (ArchetypeChunkAllocator::chunk_size - 3 * ArchetypeChunkAllocator::column_alignment)
+        / bytes_per_entity);
+}
+
+TEST_CASE("ArchetypeChunkAllocator create and access", "[archetype]")
+{
+    ArchetypeChunkAllocator archetype({component_layout<Position>(), component_layout<Transform>()}, 8);
+
+    const std::size_t per_chunk = archetype.entities_per_chunk();
+    const std::size_t count = per_chunk + 10;
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        const std::size_t row = archetype.create();
+        REQUIRE(row == i);
+        *archetype.component<Position>(row, 0) = {static_cast<float>(i), 0.0f, 0.0f};
+    }
+
+    REQUIRE(archetype.size() == count);
+    REQUIRE(archetype.chunk_count() == 2);
+    REQUIRE(archetype.chunk_entities(0) == per_chunk);
+    REQUIRE(archetype.chunk_entities(1) == 10);
+
+    SECTION("Columns are contiguous and aligned")
+    {
+        for (std::size_t chunk = 0; chunk < archetype.chunk_count(); ++chunk)
+        {
+            const auto* positions = archetype.column<Position>(chunk, 0);
+            REQUIRE(reinterpret_cast<std::uintptr_t>(positions) % ArchetypeChunkAllocator::column_alignment == 0);
+            REQUIRE(reinterpret_cast<std::uintptr_t>(archetype.column(chunk, 1)) % alignof(Transform) == 0);
+
+            for (std::size_t i = 0; i < archetype.chunk_entities(chunk); ++i)
+            {
+                REQUIRE(positions[i].x == static_cast<float>(chunk * per_chunk + i));
+            }
+        }
+    }
+}
+
+TEST_CASE("ArchetypeChunkAllocator swap-remove", "[archetype]")
+{
+    ArchetypeChunkAllocator archetype({component_layout<std::uint32_t>(), component_layout<Velocity>()}, 4);
+
+    for (std::uint32_t i = 0; i < 5; ++i)
+    {
+        const std::size_t row = archetype.create();
+        *archetype.component<std::uint32_t>(row, 0) = i;
+        *archetype.component<Velocity>(row, 1) = {static_cast<float>(i), 1.0f, 2.0f};
+    }
+
+    SECTION("Removing a middle row moves the last entity into it")
+    {
+        REQUIRE(archetype.destroy(1) == 4);
+        REQUIRE(archetype.size() == 4);
+        REQUIRE(*archetype.component<std::uint32_t>(1, 0) == 4);
+        REQUIRE(archetype.component<Velocity>(1, 1)->x == 4.0f);
+    }
+
+    SECTION("Removing the last row moves nothing")
+    {
+        REQUIRE(archetype.destroy(4) == ArchetypeChunkAllocator::npos);
+        REQUIRE(archetype.size() == 4);
+        REQUIRE(*archetype.component<std::uint32_t>(3, 0) == 3);
+    }
+}
+
+TEST_CASE("ArchetypeChunkAllocator chunk reuse", "[archetype]")
+{
+    ArchetypeChunkAllocator archetype({component_layout<Position>()}, 2);
+    const std::size_t per_chunk = archetype.entities_per_chunk();
+
+    for (std::size_t i = 0; i < 2 * per_chunk; ++i)
+    {
+        REQUIRE(archetype.create() != ArchetypeChunkAllocator::npos);
+    }
+    REQUIRE(archetype.chunk_count() == 2);
+
+    // Pool exhausted
+    REQUIRE(archetype.create() == ArchetypeChunkAllocator::npos);
+
+    // Emptying the last chunk hands it back
+    for (std::size_t i = 0; i < per_chunk; ++i)
+    {
+        archetype.destroy(0);
+    }
+    REQUIRE(archetype.chunk_count() == 1);
+    REQUIRE(archetype.create() != ArchetypeChunkAllocator::npos);
+    REQUIRE(archetype.chunk_count() == 2);
+
+    archetype.clear();
+    REQUIRE(archetype.size() == 0);
+    REQUIRE(archetype.chunk_count() == 0);
+}
+
+TEST_CASE("ArchetypeChunkAllocator move semantics", "[archetype]")
+{
+    ArchetypeChunkAllocator archetype1({component_layout<std::uint32_t>()}, 2);
+    const std::size_t row = archetype1.create();
+    *archetype1.component<std::uint32_t>(row, 0) = 42;
+
+    ArchetypeChunkAllocator archetype2(std::move(archetype1));
+    REQUIRE(archetype2.size() == 1);
+    REQUIRE(*archetype2.component<std::uint32_t>(0, 0) == 42);
+}
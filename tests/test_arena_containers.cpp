@@ -0,0 +1,228 @@
+#include <catch2/catch_test_macros.hpp>
+#include "arena_containers.h"
+#include "binned_arena_allocator.h"
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+using namespace fast_alloc;
+
+TEST_CASE("ArenaVector grows in place at the top of the arena", "[arena_containers]")
+{
+    StackAllocator arena(64 * 1024);
+    ArenaVector<std::uint32_t> values(arena);
+
+    REQUIRE(values.push_back(0) != nullptr);
+    const std::uint32_t* first_buffer = values.data();
+
+    for (std::uint32_t i = 1; i < 1000; ++i)
+    {
+        REQUIRE(values.push_back(i) != nullptr);
+    }
+
+    // Nothing else was allocated, so every growth extended the same buffer
+    REQUIRE(values.data() == first_buffer);
+    REQUIRE(values.size() == 1000);
+    REQUIRE(arena.used() == values.capacity() * sizeof(std::uint32_t));
+    for (std::uint32_t i = 0; i < 1000; ++i)
+    {
+        REQUIRE(values[i] == i);
+    }
+}
+
+TEST_CASE("ArenaVector copies when something was allocated after it", "[arena_containers]")
+{
+    StackAllocator arena(64 * 1024);
+    ArenaVector<std::uint64_t> values(arena, 4);
+    for (std::uint64_t i = 0; i < 4; ++i)
+    {
+        values.push_back(i);
+    }
+    const std::uint64_t* old_buffer = values.data();
+
+    REQUIRE(arena.allocate(16) != nullptr); // Buries the buffer
+    REQUIRE(values.push_back(4) != nullptr);
+
+    REQUIRE(values.data() != old_buffer);
+    REQUIRE(values.size() == 5);
+    for (std::uint64_t i = 0; i < 5; ++i)
+    {
+        REQUIRE(values[i] == i);
+    }
+}
+
+TEST_CASE("ArenaVector operations", "[arena_containers]")
+{
+    StackAllocator arena(4096);
+    ArenaVector<int> values(arena);
+
+    SECTION("Clear keeps the buffer")
+    {
+        values.push_back(1);
+        values.push_back(2);
+        const std::size_t capacity = values.capacity();
+
+        values.clear();
+        REQUIRE(values.empty());
+        REQUIRE(values.capacity() == capacity);
+    }
+
+    SECTION("Resize value-initialises")
+    {
+        REQUIRE(values.resize(10));
+        for (int value : values)
+        {
+            REQUIRE(value == 0);
+        }
+        values.pop_back();
+        REQUIRE(values.size() == 9);
+    }
+
+    SECTION("Append and move")
+    {
+        const int more[] = {4, 5, 6};
+        REQUIRE(values.append(more, 3));
+
+        ArenaVector<int> moved(std::move(values));
+        REQUIRE(moved.size() == 3);
+        REQUIRE(moved.back() == 6);
+        REQUIRE(values.empty());
+    }
+
+    SECTION("Exhaustion leaves the vector unchanged")
+    {
+        StackAllocator tiny(64);
+        ArenaVector<std::uint64_t> small(tiny);
+        std::size_t pushed = 0;
+        while (small.push_back(pushed))
+        {
+            ++pushed;
+        }
+
+        REQUIRE(pushed == 8);
+        REQUIRE(small.size() == 8);
+        REQUIRE(small.back() == 7);
+    }
+
+    SECTION("Works over other arenas")
+    {
+        BinnedArenaAllocator binned(4096);
+        ArenaVector<int, BinnedArenaAllocator> other(binned);
+        for (int i = 0; i < 100; ++i)
+        {
+            REQUIRE(other.push_back(i) != nullptr);
+        }
+        REQUIRE(other[99] == 99);
+    }
+}
+
+TEST_CASE("ArenaString", "[arena_containers]")
+{
+    StackAllocator arena(4096);
+    ArenaString name(arena, "fast");
+
+    REQUIRE(name == "fast");
+    REQUIRE(name.append("-alloc"));
+    REQUIRE(name.push_back('!'));
+    REQUIRE(name.view() == "fast-alloc!");
+    REQUIRE(std::string(name.c_str()) == "fast-alloc!");
+    REQUIRE(name.size() == 11);
+
+    name.clear();
+    REQUIRE(name.empty());
+    REQUIRE(std::string_view(name.c_str()).empty());
+
+    ArenaString empty(arena);
+    REQUIRE(std::string_view(empty.c_str()).empty());
+}
+
+TEST_CASE("ArenaHashMap insert, find and erase", "[arena_containers]")
+{
+    StackAllocator arena(256 * 1024);
+    ArenaHashMap<std::uint32_t, std::uint32_t> map(arena);
+
+    for (std::uint32_t i = 0; i < 1000; ++i)
+    {
+        auto [value, inserted] = map.insert(i, i * 2);
+        REQUIRE(value != nullptr);
+        REQUIRE(inserted);
+    }
+    REQUIRE(map.size() == 1000);
+
+    auto [existing, inserted] = map.insert(5, 0);
+    REQUIRE_FALSE(inserted);
+    REQUIRE(*existing == 10);
+
+    REQUIRE(*map.insert_or_assign(5, 7) == 7);
+
+    for (std::uint32_t i = 0; i < 1000; i += 2)
+    {
+        REQUIRE(map.erase(i));
+    }
+    REQUIRE_FALSE(map.erase(0));
+    REQUIRE(map.size() == 500);
+
+    // Erasing shifts entries back; every survivor must still be reachable
+    for (std::uint32_t i = 0; i < 1000; ++i)
+    {
+        REQUIRE(map.contains(i) == (i % 2 == 1));
+    }
+    REQUIRE(*map.find(999) == 1998);
+}
+
+TEST_CASE("ArenaHashMap clears in O(1) and reuses its slots", "[arena_containers]")
+{
+    StackAllocator arena(64 * 1024);
+    ArenaHashMap<std::string_view, int> map(arena, 100);
+    const std::size_t slots = map.slot_count();
+    const std::size_t used = arena.used();
+
+    for (int round = 0; round < 10; ++round)
+    {
+        REQUIRE(map.insert("alpha", round).second);
+        REQUIRE(map.insert("beta", round).second);
+        REQUIRE(*map.find("alpha") == round);
+
+        map.clear();
+        REQUIRE(map.empty());
+        REQUIRE_FALSE(map.contains("alpha"));
+    }
+
+    // No growth, so nothing new was taken from the arena
+    REQUIRE(map.slot_count() == slots);
+    REQUIRE(arena.used() == used);
+}
+
+TEST_CASE("ArenaHashMap matches std::unordered_map", "[arena_containers]")
+{
+    StackAllocator arena(1024 * 1024);
+    ArenaHashMap<std::uint64_t, std::uint64_t> map(arena);
+    std::unordered_map<std::uint64_t, std::uint64_t> reference;
+
+    std::uint64_t state = 12345;
+    for (int i = 0; i < 20000; ++i)
+    {
+        state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+        const std::uint64_t key = (state >> 33) % 2048;
+
+        if (state & 1)
+        {
+            map.insert_or_assign(key, state);
+            reference[key] = state;
+        }
+        else
+        {
+            REQUIRE(map.erase(key) == (reference.erase(key) == 1));
+        }
+    }
+
+    REQUIRE(map.size() == reference.size());
+    std::size_t visited = 0;
+    map.for_each([&](const std::uint64_t key, const std::uint64_t value)
+    {
+        REQUIRE(reference.at(key) == value);
+        ++visited;
+    });
+    REQUIRE(visited == reference.size());
+}
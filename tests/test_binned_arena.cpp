@@ -0,0 +1,158 @@
+#include <catch2/catch_test_macros.hpp>
+#include "binned_arena_allocator.h"
+#include <cstdint>
+#include <vector>
+
+using namespace fast_alloc;
+
+TEST_CASE("BinnedArenaAllocator basic allocation", "[binned_arena]")
+{
+    BinnedArenaAllocator arena(4096);
+
+    void* a = arena.allocate(24);
+    void* b = arena.allocate(100);
+
+    REQUIRE(a != nullptr);
+    REQUIRE(b != nullptr);
+    REQUIRE(a != b);
+    REQUIRE(reinterpret_cast<std::uintptr_t>(a) % alignof(std::max_align_t) == 0);
+    REQUIRE(reinterpret_cast<std::uintptr_t>(b) % alignof(std::max_align_t) == 0);
+
+    // Size classes round up to powers of 2
+    REQUIRE(arena.used() == 32 + 128);
+}
+
+TEST_CASE("BinnedArenaAllocator recycles freed chunks", "[binned_arena]")
+{
+    BinnedArenaAllocator arena(4096);
+
+    void* a = arena.allocate(48);
+    void* b = arena.allocate(48);
+    const std::size_t used = arena.used();
+
+    arena.deallocate(a, 48);
+    REQUIRE(arena.recycled() == 64);
+
+    SECTION("Same size class reuses the chunk")
+    {
+        void* c = arena.allocate(60);
+        REQUIRE(c == a);
+        REQUIRE(arena.used() == used);
+        REQUIRE(arena.recycled() == 0);
+    }
+
+    SECTION("Different size class bumps")
+    {
+        void* c = arena.allocate(200);
+        REQUIRE(c != a);
+        REQUIRE(arena.used() > used);
+    }
+
+    arena.deallocate(b, 48);
+}
+
+TEST_CASE("BinnedArenaAllocator rolls back the last allocation", "[binned_arena]")
+{
+    BinnedArenaAllocator arena(16 * 1024);
+
+    void* a = arena.allocate(32);
+    const std::size_t used = arena.used();
+
+    void* b = arena.allocate(1000);
+    arena.deallocate(b, 1000);
+    REQUIRE(arena.used() == used);
+    REQUIRE(arena.recycled() == 0);
+
+    void* big = arena.allocate(5000);
+    REQUIRE(big != nullptr);
+    arena.deallocate(big, 5000);
+    REQUIRE(arena.used() == used);
+
+    arena.deallocate(a, 32);
+    REQUIRE(arena.used() == 0);
+}
+
+TEST_CASE("BinnedArenaAllocator bounded footprint under churn", "[binned_arena]")
+{
+    BinnedArenaAllocator arena(64 * 1024);
+    std::vector<void*> live;
+    std::vector<std::size_t> sizes;
+
+    // Many frees interleaved with allocations of mixed sizes
+    for (int round = 0; round < 1000; ++round)
+    {
+        const std::size_t size = 16 + static_cast<std::size_t>(round % 7) * 40;
+        void* ptr = arena.allocate(size);
+        REQUIRE(ptr != nullptr);
+        live.push_back(ptr);
+        sizes.push_back(size);
+
+        // Free a scattered live chunk
+        if (live.size() > 8)
+        {
+            const std::size_t victim = static_cast<std::size_t>(round) % live.size();
+            arena.deallocate(live[victim], sizes[victim]);
+            live.erase(live.begin() + static_cast<std::ptrdiff_t>(victim));
+            sizes.erase(sizes.begin() + static_cast<std::ptrdiff_t>(victim));
+        }
+    }
+
+    // Without recycling this would need ~1000 chunks
+    REQUIRE(arena.used() < 64 * 512);
+}
+
+TEST_CASE("BinnedArenaAllocator large and over-aligned allocations", "[binned_arena]")
+{
+    BinnedArenaAllocator arena(64 * 1024);
+
+    void* filler = arena.allocate(16);
+    void* aligned = arena.allocate(64, 256);
+    REQUIRE(aligned != nullptr);
+    REQUIRE(reinterpret_cast<std::uintptr_t>(aligned) % 256 == 0);
+
+    void* large = arena.allocate(BinnedArenaAllocator::max_binned_size + 1);
+    REQUIRE(large != nullptr);
+
+    // Not the last allocation and not binned - reclaimed only by reset()
+    arena.deallocate(aligned, 64, 256);
+    REQUIRE(arena.recycled() == 0);
+
+    arena.deallocate(large, BinnedArenaAllocator::max_binned_size + 1);
+    arena.deallocate(filler, 16);
+}
+
+TEST_CASE("BinnedArenaAllocator reset", "[binned_arena]")
+{
+    BinnedArenaAllocator arena(1024);
+
+    void* a = arena.allocate(64);
+    arena.allocate(64);
+    arena.deallocate(a, 64);
+    REQUIRE(arena.recycled() == 64);
+
+    arena.reset();
+    REQUIRE(arena.used() == 0);
+    REQUIRE(arena.recycled() == 0);
+    REQUIRE(arena.available() == arena.capacity());
+}
+
+TEST_CASE("BinnedArenaAllocator exhaustion", "[binned_arena]")
+{
+    BinnedArenaAllocator arena(256);
+
+    REQUIRE(arena.allocate(128) != nullptr);
+    REQUIRE(arena.allocate(128) != nullptr);
+    REQUIRE(arena.allocate(16) == nullptr);
+}
+
+TEST_CASE("BinnedArenaAllocator move semantics", "[binned_arena]")
+{
+    BinnedArenaAllocator arena1(1024);
+    void* a = arena1.allocate(32);
+    arena1.allocate(32);
+    arena1.deallocate(a, 32);
+
+    BinnedArenaAllocator arena2(std::move(arena1));
+    REQUIRE(arena2.recycled() == 32);
+    REQUIRE(arena2.allocate(32) == a);
+}
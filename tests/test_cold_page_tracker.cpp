@@ -0,0 +1,126 @@
+#include <catch2/catch_test_macros.hpp>
+#include "cold_page_tracker.h"
+#include "pool_allocator.h"
+#include "stack_allocator.h"
+#include <cstring>
+#include <vector>
+
+#ifdef __linux__
+#include <sys/mman.h>
+#endif
+
+using namespace fast_alloc;
+
+TEST_CASE("ColdPageTracker span layout", "[cold_pages]")
+{
+    StackAllocator stack(1024 * 1024);
+    ColdPageTracker tracker(stack, 64 * 1024);
+
+    REQUIRE(tracker.span_size() == 64 * 1024);
+    REQUIRE(tracker.span_count() >= 15); // Partial pages at the ends are not tracked
+    REQUIRE(tracker.span_count() <= 16);
+    REQUIRE(tracker.epoch() == 0);
+    REQUIRE(tracker.demoted_spans() == 0);
+}
+
+TEST_CASE("ColdPageTracker span size rounds up to a power-of-2 page count", "[cold_pages]")
+{
+    StackAllocator stack(1024 * 1024);
+    ColdPageTracker tracker(stack, 1);
+
+    REQUIRE(tracker.span_size() >= 4096);
+    REQUIRE((tracker.span_size() & (tracker.span_size() - 1)) == 0);
+}
+
+TEST_CASE("ColdPageTracker demotes only idle spans", "[cold_pages]")
+{
+    constexpr std::size_t block_size = 4096;
+    PoolAllocator pool(block_size, 256, 4096); // Page-aligned, 1 MiB
+    ColdPageTracker tracker(pool, 64 * 1024, 2);
+
+    std::vector<void*> blocks;
+    for (std::size_t i = 0; i < pool.capacity(); ++i)
+    {
+        void* block = pool.allocate();
+        std::memset(block, static_cast<int>(i), block_size);
+        blocks.push_back(block);
+    }
+
+    // Not idle long enough yet
+    tracker.tick();
+    REQUIRE(tracker.demote() == 0);
+
+    // Keep the first span hot
+    tracker.touch(blocks[0]);
+    tracker.tick();
+
+    if (!ColdPageTracker::supported())
+    {
+        REQUIRE(tracker.demote() == 0);
+        return;
+    }
+
+    const std::size_t demoted = tracker.demote();
+    REQUIRE(demoted == (tracker.span_count() - 1) * tracker.span_size());
+    REQUIRE(tracker.demoted_spans() == tracker.span_count() - 1);
+
+    // Already demoted spans are not advised again
+    REQUIRE(tracker.demote() == 0);
+
+    // Contents survive demotion, even when paged out
+    REQUIRE(tracker.demote(ColdAdvice::PageOut) == 0);
+    for (std::size_t i = 0; i < blocks.size(); ++i)
+    {
+        REQUIRE(*static_cast<unsigned char*>(blocks[i]) == static_cast<unsigned char>(i));
+    }
+
+    // Touching a demoted span makes it resident in the tracker's eyes again
+    tracker.touch(blocks.back(), block_size);
+    REQUIRE(tracker.demoted_spans() == tracker.span_count() - 2);
+
+    for (void* block : blocks)
+    {
+        pool.deallocate(block);
+    }
+}
+
+#ifdef __linux__
+TEST_CASE("ColdPageTracker keeps spans whose advice failed eligible", "[cold_pages]")
+{
+    // Unmapped pages: madvise() fails with ENOMEM
+    constexpr std::size_t size = 256 * 1024;
+    void* region = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    REQUIRE(region != MAP_FAILED);
+    REQUIRE(munmap(region, size) == 0);
+
+    ColdPageTracker tracker(region, size, 64 * 1024, 1);
+    tracker.tick();
+
+    REQUIRE(tracker.demote() == 0);
+    REQUIRE(tracker.demoted_spans() == 0);
+}
+#endif
+
+TEST_CASE("ColdPageTracker ignores pointers outside the range", "[cold_pages]")
+{
+    StackAllocator stack(256 * 1024);
+    ColdPageTracker tracker(stack, 64 * 1024);
+
+    int outside = 0;
+    tracker.touch(&outside);
+    tracker.touch(&outside, sizeof(outside));
+    tracker.touch(nullptr);
+    REQUIRE(tracker.demoted_spans() == 0);
+}
+
+TEST_CASE("ColdPageTracker move semantics", "[cold_pages]")
+{
+    StackAllocator stack(256 * 1024);
+    ColdPageTracker tracker1(stack, 64 * 1024, 3);
+    tracker1.tick();
+
+    ColdPageTracker tracker2(std::move(tracker1));
+    REQUIRE(tracker2.epoch() == 1);
+    REQUIRE(tracker2.idle_ticks() == 3);
+    REQUIRE(tracker2.span_count() > 0);
+}
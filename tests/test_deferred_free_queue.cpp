@@ -0,0 +1,157 @@
+#include <catch2/catch_test_macros.hpp>
+#include "deferred_free_queue.h"
+#include "freelist_allocator.h"
+#include "pool_allocator.h"
+#include "threadsafe_pool_allocator.h"
+#include <chrono>
+#include <thread>
+#include <vector>
+
+using namespace fast_alloc;
+
+TEST_CASE("DeferredFreeQueue frees on drain", "[deferred_free]")
+{
+    PoolAllocator pool(64, 16);
+    DeferredFreeQueue deferred(pool);
+
+    std::vector<void*> blocks;
+    for (int i = 0; i < 16; ++i)
+    {
+        blocks.push_back(pool.allocate());
+    }
+    REQUIRE(pool.is_full());
+
+    for (void* block : blocks)
+    {
+        deferred.push(block, pool.block_size());
+    }
+    deferred.push(nullptr, 64); // Ignored
+
+    // Nothing is freed until the consumer runs
+    REQUIRE(deferred.pending() == 16);
+    REQUIRE(pool.allocated() == 16);
+
+    REQUIRE(deferred.drain(10) == 10);
+    REQUIRE(pool.allocated() == 6);
+    REQUIRE(deferred.drain() == 6);
+    REQUIRE(pool.allocated() == 0);
+    REQUIRE(deferred.pending() == 0);
+    REQUIRE(deferred.drain() == 0);
+
+    SECTION("Queue is reusable after draining empty")
+    {
+        void* block = pool.allocate();
+        deferred.push(block, 64);
+        REQUIRE(deferred.drain() == 1);
+        REQUIRE(pool.allocated() == 0);
+    }
+}
+
+TEST_CASE("DeferredFreeQueue forwards size and alignment", "[deferred_free]")
+{
+    FreeListAllocator heap(64 * 1024);
+    DeferredFreeQueue deferred(heap);
+
+    void* a = heap.allocate(100, 64);
+    void* b = heap.allocate(3000);
+    REQUIRE(heap.num_allocations() == 2);
+
+    deferred.push(a, 100, 64);
+    deferred.push(b, 3000);
+    REQUIRE(deferred.drain() == 2);
+    REQUIRE(heap.num_allocations() == 0);
+    REQUIRE(heap.used() == 0);
+}
+
+TEST_CASE("DeferredFreeQueue frees the rest on destruction", "[deferred_free]")
+{
+    PoolAllocator pool(32, 4);
+    {
+        DeferredFreeQueue deferred(pool);
+        deferred.push(pool.allocate(), 32);
+        deferred.push(pool.allocate(), 32);
+        REQUIRE(pool.allocated() == 2);
+    }
+    REQUIRE(pool.allocated() == 0);
+}
+
+TEST_CASE("DeferredFreeQueue with concurrent producers", "[deferred_free]")
+{
+    constexpr int producers = 4;
+    constexpr int per_producer = 5000;
+
+    PoolAllocator pool(32, producers * per_producer);
+    std::vector<void*> blocks;
+    for (int i = 0; i < producers * per_producer; ++i)
+    {
+        blocks.push_back(pool.allocate());
+    }
+
+    DeferredFreeQueue deferred(pool);
+    std::atomic<bool> done{false};
+
+    // Only this consumer touches the pool while producers run
+    std::thread consumer([&]
+    {
+        while (!done.load(std::memory_order_acquire))
+        {
+            deferred.drain();
+        }
+    });
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < producers; ++t)
+    {
+        threads.emplace_back([&, t]
+        {
+            for (int i = 0; i < per_producer; ++i)
+            {
+                deferred.push(blocks[t * per_producer + i], 32);
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    done.store(true, std::memory_order_release);
+    consumer.join();
+    deferred.drain();
+
+    REQUIRE(deferred.pending() == 0);
+    REQUIRE(pool.allocated() == 0);
+}
+
+TEST_CASE("DeferredFreeQueue background worker", "[deferred_free]")
+{
+    ThreadSafePoolAllocator pool(64, 1000);
+    DeferredFreeQueue deferred(pool);
+    deferred.start_worker(std::chrono::microseconds(100));
+    REQUIRE(deferred.worker_running());
+
+    for (int round = 0; round < 10; ++round)
+    {
+        std::vector<void*> blocks;
+        for (int i = 0; i < 100; ++i)
+        {
+            blocks.push_back(pool.allocate());
+        }
+        for (void* block : blocks)
+        {
+            deferred.push(block, 64);
+        }
+    }
+
+    // The worker catches up on its own
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (deferred.pending() > 0 && std::chrono::steady_clock::now() < deadline)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    REQUIRE(deferred.pending() == 0);
+    REQUIRE(pool.allocated() == 0);
+
+    deferred.stop_worker();
+    REQUIRE_FALSE(deferred.worker_running());
+}
@@ -0,0 +1,166 @@
+#include <catch2/catch_test_macros.hpp>
+#include "fiber_stack_pool.h"
+#include <csignal>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#ifdef __linux__
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+using namespace fast_alloc;
+
+TEST_CASE("FiberStackPool basic allocation", "[fiber_stack]")
+{
+    FiberStackPool pool(64 * 1024, 4);
+
+    REQUIRE(pool.valid());
+    REQUIRE(pool.stack_size() == 64 * 1024);
+    REQUIRE(pool.capacity() == 4);
+    REQUIRE(pool.guard_size() > 0);
+
+    void* stack = pool.allocate();
+    REQUIRE(stack != nullptr);
+    REQUIRE(pool.allocated() == 1);
+
+    // Whole stack is usable
+    std::memset(stack, 0xCD, pool.stack_size());
+    REQUIRE(static_cast<std::byte*>(pool.top(stack)) == static_cast<std::byte*>(stack) + pool.stack_size());
+
+    pool.deallocate(stack);
+    REQUIRE(pool.allocated() == 0);
+}
+
+TEST_CASE("FiberStackPool stack size rounds up to pages", "[fiber_stack]")
+{
+    FiberStackPool pool(1000, 2);
+
+    REQUIRE(pool.stack_size() >= 1000);
+    REQUIRE(pool.stack_size() % pool.guard_size() == 0);
+
+    void* stack = pool.allocate();
+    REQUIRE(reinterpret_cast<std::uintptr_t>(stack) % pool.guard_size() == 0);
+    pool.deallocate(stack);
+}
+
+TEST_CASE("FiberStackPool exhaustion and distinct stacks", "[fiber_stack]")
+{
+    FiberStackPool pool(16 * 1024, 3);
+
+    void* a = pool.allocate();
+    void* b = pool.allocate();
+    void* c = pool.allocate();
+
+    REQUIRE(a != nullptr);
+    REQUIRE(b != nullptr);
+    REQUIRE(c != nullptr);
+    REQUIRE(pool.allocate() == nullptr);
+
+    // Stacks are separated by at least a guard page
+    const auto distance = static_cast<std::size_t>(static_cast<std::byte*>(b) - static_cast<std::byte*>(a));
+    REQUIRE(distance == pool.stack_size() + pool.guard_size());
+
+    pool.deallocate(a);
+    pool.deallocate(b);
+    pool.deallocate(c);
+}
+
+TEST_CASE("FiberStackPool reuses warm stacks first", "[fiber_stack]")
+{
+    FiberStackPool pool(16 * 1024, 4);
+
+    void* a = pool.allocate();
+    void* b = pool.allocate();
+    pool.deallocate(a);
+    REQUIRE(pool.warm() == 1);
+
+    REQUIRE(pool.allocate() == a);
+    REQUIRE(pool.warm() == 0);
+
+    pool.deallocate(a);
+    pool.deallocate(b);
+    REQUIRE(pool.warm() == 2);
+}
+
+TEST_CASE("FiberStackPool decommits above the watermark", "[fiber_stack]")
+{
+    FiberStackPool pool(16 * 1024, 4, 1);
+    REQUIRE(pool.warm_watermark() == 1);
+
+    void* a = pool.allocate();
+    void* b = pool.allocate();
+    std::memset(a, 0xAB, pool.stack_size());
+    std::memset(b, 0xAB, pool.stack_size());
+
+    pool.deallocate(a); // Kept warm
+    pool.deallocate(b); // Above watermark - decommitted
+    REQUIRE(pool.warm() == 1);
+
+    // Warm stack comes back first with its contents
+    void* warm = pool.allocate();
+    REQUIRE(warm == a);
+    REQUIRE(*static_cast<unsigned char*>(warm) == 0xAB);
+
+    void* cold = pool.allocate();
+    REQUIRE(cold == b);
+
+#ifdef __linux__
+    // MADV_DONTNEED on private anonymous memory drops the old contents
+    REQUIRE(*static_cast<unsigned char*>(cold) == 0);
+#endif
+
+    std::memset(cold, 0xEF, pool.stack_size()); // Recommitted and writable
+
+    pool.deallocate(warm);
+    pool.deallocate(cold);
+}
+
+TEST_CASE("FiberStackPool move semantics", "[fiber_stack]")
+{
+    FiberStackPool pool1(16 * 1024, 2);
+    void* stack = pool1.allocate();
+
+    FiberStackPool pool2(std::move(pool1));
+    REQUIRE(pool2.valid());
+    REQUIRE_FALSE(pool1.valid());
+    REQUIRE(pool1.allocate() == nullptr);
+    REQUIRE(pool2.allocated() == 1);
+    REQUIRE(pool2.capacity() == 2);
+
+    pool2.deallocate(stack);
+    REQUIRE(pool2.allocated() == 0);
+}
+
+#ifdef __linux__
+TEST_CASE("FiberStackPool guard page faults on overflow", "[fiber_stack]")
+{
+    FiberStackPool pool(16 * 1024, 2);
+    void* stack = pool.allocate();
+
+    const pid_t child = fork();
+    REQUIRE(child >= 0);
+
+    if (child == 0)
+    {
+        // Die of the fault itself: no Catch signal handler, and no report from the child
+        std::signal(SIGSEGV, SIG_DFL);
+        std::signal(SIGBUS, SIG_DFL);
+        std::freopen("/dev/null", "w", stdout);
+        std::freopen("/dev/null", "w", stderr);
+
+        // Write just below the stack, into the guard page
+        volatile auto* guard = static_cast<volatile unsigned char*>(stack) - 1;
+        *guard = 1;
+        _exit(0);
+    }
+
+    int status = 0;
+    waitpid(child, &status, 0);
+    REQUIRE(WIFSIGNALED(status));
+    REQUIRE((WTERMSIG(status) == SIGSEGV || WTERMSIG(status) == SIGBUS));
+
+    pool.deallocate(stack);
+}
+#endif
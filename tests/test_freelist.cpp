@@ -1,5 +1,6 @@
 #include <catch2/catch_test_macros.hpp>
 #include "freelist_allocator.h"
+#include <cstdint>
 #include <vector>
 
 using namespace fast_alloc;
@@ -226,3 +227,117 @@ TEST_CASE("FreeListAllocator nullptr handling", "[freelist]")
     allocator.deallocate(nullptr);
     REQUIRE(allocator.num_allocations() == 0);
 }
+
+TEST_CASE("FreeListAllocator deferred coalescing", "[freelist]")
+{
+    FreeListAllocator allocator(16384, FreeListStrategy::FirstFit);
+    allocator.set_deferred_coalescing(8);
+    REQUIRE(allocator.deferred_threshold() == 8);
+
+    SECTION("Freed block is reused for the same size")
+    {
+        void* ptr = allocator.allocate(64);
+        const std::size_t used = allocator.used();
+        allocator.deallocate(ptr);
+        REQUIRE(allocator.deferred_blocks() == 1);
+        REQUIRE(allocator.used() == 0);
+        REQUIRE(allocator.num_allocations() == 0);
+
+        REQUIRE(allocator.allocate(64) == ptr);
+        REQUIRE(allocator.deferred_blocks() == 0);
+        REQUIRE(allocator.used() == used);
+        allocator.deallocate(ptr);
+    }
+
+    SECTION("Reused blocks honour alignment")
+    {
+        void* ptr = allocator.allocate(40, 8);
+        allocator.deallocate(ptr);
+
+        void* aligned = allocator.allocate(40, 64);
+        REQUIRE(aligned != nullptr);
+        REQUIRE(reinterpret_cast<std::uintptr_t>(aligned) % 64 == 0);
+        allocator.deallocate(aligned);
+    }
+
+    SECTION("Threshold merges deferred blocks")
+    {
+        std::vector<void*> ptrs;
+        for (int i = 0; i < 8; ++i)
+        {
+            ptrs.push_back(allocator.allocate(100));
+        }
+        for (int i = 0; i < 7; ++i)
+        {
+            allocator.deallocate(ptrs[i]);
+        }
+        REQUIRE(allocator.deferred_blocks() == 7);
+
+        allocator.deallocate(ptrs[7]);
+        REQUIRE(allocator.deferred_blocks() == 0);
+        REQUIRE(allocator.used() == 0);
+
+        // Everything coalesced back into one block
+        void* whole = allocator.allocate(16384 - 64);
+        REQUIRE(whole != nullptr);
+        allocator.deallocate(whole);
+    }
+
+    SECTION("Allocation miss merges deferred blocks")
+    {
+        FreeListAllocator small(1024, FreeListStrategy::FirstFit);
+        small.set_deferred_coalescing();
+
+        std::vector<void*> ptrs;
+        while (void* ptr = small.allocate(48))
+        {
+            ptrs.push_back(ptr);
+        }
+        for (void* ptr : ptrs)
+        {
+            small.deallocate(ptr);
+        }
+        REQUIRE(small.deferred_blocks() == ptrs.size());
+
+        // No quick list holds a block this large, and the free list is exhausted
+        void* large = small.allocate(512);
+        REQUIRE(large != nullptr);
+        REQUIRE(small.deferred_blocks() == 0);
+        small.deallocate(large);
+    }
+
+    SECTION("Disabling merges immediately")
+    {
+        void* a = allocator.allocate(32);
+        void* b = allocator.allocate(32);
+        allocator.deallocate(a);
+        allocator.deallocate(b);
+        REQUIRE(allocator.deferred_blocks() == 2);
+
+        allocator.set_deferred_coalescing(0);
+        REQUIRE(allocator.deferred_blocks() == 0);
+
+        // Back to immediate coalescence
+        void* c = allocator.allocate(32);
+        allocator.deallocate(c);
+        REQUIRE(allocator.deferred_blocks() == 0);
+    }
+
+    SECTION("Large blocks are never deferred")
+    {
+        void* ptr = allocator.allocate(FreeListAllocator::quick_list_max_size);
+        allocator.deallocate(ptr);
+        REQUIRE(allocator.deferred_blocks() == 0);
+    }
+
+    SECTION("Move keeps deferred blocks")
+    {
+        void* ptr = allocator.allocate(64);
+        allocator.deallocate(ptr);
+
+        FreeListAllocator moved(std::move(allocator));
+        REQUIRE(moved.deferred_blocks() == 1);
+        REQUIRE(moved.allocate(64) == ptr);
+        moved.deallocate(ptr);
+    }
+}
@@ -0,0 +1,207 @@
+#include <catch2/catch_test_macros.hpp>
+#include "inline_arena.h"
+#include "arena_containers.h"
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+using namespace fast_alloc;
+
+TEST_CASE("InlineArena allocates from the inline buffer", "[inline_arena]")
+{
+    InlineArena<256> arena;
+
+    REQUIRE(arena.inline_capacity == 256);
+    REQUIRE(arena.used() == 0);
+    REQUIRE_FALSE(arena.spilled());
+
+    void* a = arena.allocate(64);
+    void* b = arena.allocate(64);
+    REQUIRE(a != nullptr);
+    REQUIRE(b != nullptr);
+    REQUIRE(a != b);
+    REQUIRE(arena.is_inline(a));
+    REQUIRE(arena.is_inline(b));
+    REQUIRE(arena.used() == 128);
+    REQUIRE_FALSE(arena.spilled());
+    REQUIRE(arena.spill_chunk_count() == 0);
+
+    // The buffer is part of the object
+    REQUIRE(static_cast<void*>(&arena) <= a);
+    REQUIRE(static_cast<std::byte*>(b) + 64 <= reinterpret_cast<std::byte*>(&arena) + sizeof(arena));
+}
+
+TEST_CASE("InlineArena alignment", "[inline_arena]")
+{
+    InlineArena<512> arena;
+
+    REQUIRE(arena.allocate(1, 1) != nullptr);
+    void* ptr16 = arena.allocate(16, 16);
+    REQUIRE(reinterpret_cast<std::uintptr_t>(ptr16) % 16 == 0);
+
+    REQUIRE(arena.allocate(1, 1) != nullptr);
+    void* ptr64 = arena.allocate(32, 64);
+    REQUIRE(reinterpret_cast<std::uintptr_t>(ptr64) % 64 == 0);
+    REQUIRE(arena.is_inline(ptr64));
+}
+
+TEST_CASE("InlineArena spills to the heap on overflow", "[inline_arena]")
+{
+    InlineArena<128> arena(1024);
+
+    void* inside = arena.allocate(100);
+    REQUIRE(arena.is_inline(inside));
+
+    void* spilled = arena.allocate(100);
+    REQUIRE(spilled != nullptr);
+    REQUIRE_FALSE(arena.is_inline(spilled));
+    REQUIRE(arena.spilled());
+    REQUIRE(arena.spill_chunk_count() == 1);
+
+    // Further allocations continue in the chunk
+    void* next = arena.allocate(100);
+    REQUIRE_FALSE(arena.is_inline(next));
+    REQUIRE(arena.spill_chunk_count() == 1);
+
+    // Spilled memory is usable and distinct
+    std::memset(inside, 0x11, 100);
+    std::memset(spilled, 0x22, 100);
+    std::memset(next, 0x33, 100);
+    REQUIRE(static_cast<unsigned char*>(inside)[99] == 0x11);
+    REQUIRE(static_cast<unsigned char*>(spilled)[99] == 0x22);
+    REQUIRE(arena.used() >= 300);
+}
+
+TEST_CASE("InlineArena oversized allocation gets its own chunk", "[inline_arena]")
+{
+    InlineArena<64> arena(256);
+
+    void* big = arena.allocate(4096, 64);
+    REQUIRE(big != nullptr);
+    REQUIRE(reinterpret_cast<std::uintptr_t>(big) % 64 == 0);
+    REQUIRE(arena.spill_chunk_count() == 1);
+    std::memset(big, 0xAB, 4096);
+}
+
+TEST_CASE("InlineArena odd sizes spill into aligned chunks", "[inline_arena]")
+{
+    InlineArena<16> arena(1001);
+
+    void* odd = arena.allocate(1001, 1); // Chunk of max(1001, 1002) bytes
+    REQUIRE(odd != nullptr);
+    REQUIRE_FALSE(arena.is_inline(odd));
+    std::memset(odd, 0x5A, 1001);
+
+    void* big = arena.allocate(2047, 8);
+    REQUIRE(big != nullptr);
+    REQUIRE(reinterpret_cast<std::uintptr_t>(big) % 8 == 0);
+    REQUIRE(arena.spill_chunk_count() == 2);
+}
+
+TEST_CASE("InlineArena markers rewind within the inline buffer", "[inline_arena]")
+{
+    InlineArena<256> arena;
+
+    REQUIRE(arena.allocate(32) != nullptr);
+    const auto marker = arena.get_marker();
+
+    void* scratch = arena.allocate(64);
+    REQUIRE(arena.used() == 96);
+
+    arena.reset(marker);
+    REQUIRE(arena.used() == 32);
+    REQUIRE(arena.allocate(64) == scratch);
+}
+
+TEST_CASE("InlineArena markers rewind across spilled chunks", "[inline_arena]")
+{
+    InlineArena<128> arena(256);
+
+    REQUIRE(arena.allocate(100) != nullptr);
+    const auto inline_marker = arena.get_marker();
+
+    void* first = arena.allocate(200); // Spills
+    REQUIRE(arena.spilled());
+    const auto spill_marker = arena.get_marker();
+
+    REQUIRE(arena.allocate(200) != nullptr); // Second chunk
+    REQUIRE(arena.spill_chunk_count() == 2);
+
+    arena.reset(spill_marker);
+    REQUIRE(arena.spilled());
+    REQUIRE(arena.used() == 100 + 200);
+
+    arena.reset(inline_marker);
+    REQUIRE_FALSE(arena.spilled());
+    REQUIRE(arena.used() == 100);
+
+    // Chunks are kept and reused in order
+    REQUIRE(arena.allocate(200) == first);
+    REQUIRE(arena.spill_chunk_count() == 2);
+}
+
+TEST_CASE("InlineArena reset and shrink", "[inline_arena]")
+{
+    InlineArena<64> arena(128);
+
+    for (int i = 0; i < 8; ++i)
+    {
+        REQUIRE(arena.allocate(100) != nullptr);
+    }
+    REQUIRE(arena.spill_chunk_count() == 8);
+
+    arena.reset();
+    REQUIRE(arena.used() == 0);
+    REQUIRE_FALSE(arena.spilled());
+    REQUIRE(arena.spill_chunk_count() == 8);
+
+    // Refilling reuses the chunks
+    for (int i = 0; i < 8; ++i)
+    {
+        REQUIRE(arena.allocate(100) != nullptr);
+    }
+    REQUIRE(arena.spill_chunk_count() == 8);
+
+    arena.reset();
+    REQUIRE(arena.allocate(16) != nullptr);
+    arena.shrink();
+    REQUIRE(arena.spill_chunk_count() == 0);
+}
+
+TEST_CASE("InlineArena try_grow", "[inline_arena]")
+{
+    InlineArena<256> arena(512);
+
+    void* a = arena.allocate(32);
+    REQUIRE(arena.try_grow(a, 32, 128));
+    REQUIRE(arena.used() == 128);
+
+    // Cannot grow past the inline buffer, or anything but the last allocation
+    REQUIRE_FALSE(arena.try_grow(a, 128, 512));
+    void* b = arena.allocate(16);
+    REQUIRE_FALSE(arena.try_grow(a, 128, 160));
+
+    // In a spilled chunk
+    void* c = arena.allocate(200);
+    REQUIRE_FALSE(arena.is_inline(c));
+    REQUIRE(arena.try_grow(c, 200, 300));
+    REQUIRE_FALSE(arena.try_grow(b, 16, 32));
+}
+
+TEST_CASE("InlineArena backs arena containers", "[inline_arena]")
+{
+    InlineArena<1024> arena(4096);
+
+    ArenaVector<int, InlineArena<1024>> values(arena);
+    for (int i = 0; i < 1000; ++i)
+    {
+        values.push_back(i);
+    }
+
+    REQUIRE(values.size() == 1000);
+    REQUIRE(arena.spilled());
+    for (int i = 0; i < 1000; ++i)
+    {
+        REQUIRE(values[static_cast<std::size_t>(i)] == i);
+    }
+}
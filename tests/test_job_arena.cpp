@@ -0,0 +1,159 @@
+#include <catch2/catch_test_macros.hpp>
+#include "job_arena_allocator.h"
+#include <atomic>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+using namespace fast_alloc;
+
+TEST_CASE("JobArenaAllocator basic allocation", "[job_arena]")
+{
+    JobArenaAllocator jobs(4, 1024);
+
+    REQUIRE(jobs.worker_count() == 4);
+    REQUIRE(jobs.max_graphs() == 2);
+    REQUIRE(jobs.chunk_count() == 0);
+
+    const JobGraph graph = jobs.begin_graph();
+    REQUIRE(graph.valid());
+
+    void* a = jobs.allocate(graph, 0, 100);
+    void* b = jobs.allocate(graph, 1, 100);
+    REQUIRE(a != nullptr);
+    REQUIRE(b != nullptr);
+    REQUIRE(a != b);
+    REQUIRE(jobs.chunk_count() == 2); // One chunk per worker that allocated
+    REQUIRE(jobs.used(graph) >= 200);
+
+    jobs.end_graph(graph);
+}
+
+TEST_CASE("JobArenaAllocator alignment", "[job_arena]")
+{
+    JobArenaAllocator jobs(1, 1024);
+    const JobGraph graph = jobs.begin_graph();
+
+    jobs.allocate(graph, 0, 1);
+    void* ptr = jobs.allocate(graph, 0, 32, 64);
+    REQUIRE(reinterpret_cast<std::uintptr_t>(ptr) % 64 == 0);
+
+    jobs.end_graph(graph);
+}
+
+TEST_CASE("JobArenaAllocator grows and reuses chunks", "[job_arena]")
+{
+    JobArenaAllocator jobs(1, 256);
+
+    JobGraph graph = jobs.begin_graph();
+    for (int i = 0; i < 10; ++i)
+    {
+        REQUIRE(jobs.allocate(graph, 0, 100) != nullptr);
+    }
+    const std::size_t chunks = jobs.chunk_count();
+    REQUIRE(chunks > 1);
+
+    // Oversized request gets a chunk of its own
+    void* big = jobs.allocate(graph, 0, 4096);
+    REQUIRE(big != nullptr);
+    std::memset(big, 0, 4096);
+    REQUIRE(jobs.chunk_count() == chunks + 1);
+    jobs.end_graph(graph);
+
+    // Next graph in the same slot reuses the chunks instead of growing
+    graph = jobs.begin_graph();
+    REQUIRE(jobs.used(graph) == 0);
+    for (int i = 0; i < 10; ++i)
+    {
+        REQUIRE(jobs.allocate(graph, 0, 100) != nullptr);
+    }
+    REQUIRE(jobs.chunk_count() == chunks + 1);
+    jobs.end_graph(graph);
+}
+
+TEST_CASE("JobArenaAllocator overlapping graphs", "[job_arena]")
+{
+    JobArenaAllocator jobs(2, 1024, 2);
+
+    const JobGraph frame1 = jobs.begin_graph();
+    const JobGraph frame2 = jobs.begin_graph();
+    REQUIRE(frame1.valid());
+    REQUIRE(frame2.valid());
+    REQUIRE(frame1.slot != frame2.slot);
+
+    // Every slot is in flight
+    REQUIRE_FALSE(jobs.begin_graph().valid());
+
+    auto* kept = static_cast<int*>(jobs.allocate(frame2, 0, sizeof(int)));
+    *kept = 42;
+    jobs.allocate(frame1, 0, 128);
+
+    // Ending frame 1 leaves frame 2's data untouched
+    jobs.end_graph(frame1);
+    REQUIRE(*kept == 42);
+    REQUIRE(jobs.used(frame2) >= sizeof(int));
+
+    const JobGraph frame3 = jobs.begin_graph();
+    REQUIRE(frame3.valid());
+    REQUIRE(frame3.slot == frame1.slot);
+    REQUIRE(frame3.generation != frame1.generation);
+
+    jobs.end_graph(frame2);
+    jobs.end_graph(frame3);
+}
+
+TEST_CASE("JobArenaAllocator concurrent workers", "[job_arena]")
+{
+    constexpr std::size_t worker_count = 4;
+    constexpr int jobs_per_worker = 1000;
+
+    JobArenaAllocator jobs(worker_count, 4096);
+    const JobGraph graph = jobs.begin_graph();
+
+    std::atomic<int> failures{0};
+    std::vector<std::thread> workers;
+    for (std::size_t w = 0; w < worker_count; ++w)
+    {
+        workers.emplace_back([&, w]
+        {
+            std::vector<std::uint64_t*> mine;
+            for (int i = 0; i < jobs_per_worker; ++i)
+            {
+                auto* value = static_cast<std::uint64_t*>(jobs.allocate(graph, w, sizeof(std::uint64_t)));
+                *value = w * jobs_per_worker + i;
+                mine.push_back(value);
+            }
+            for (int i = 0; i < jobs_per_worker; ++i)
+            {
+                if (*mine[i] != w * jobs_per_worker + i)
+                {
+                    failures.fetch_add(1, std::memory_order_relaxed);
+                }
+            }
+        });
+    }
+
+    for (auto& worker : workers)
+    {
+        worker.join();
+    }
+
+    REQUIRE(failures.load() == 0);
+    REQUIRE(jobs.used(graph) >= worker_count * jobs_per_worker * sizeof(std::uint64_t));
+
+    jobs.end_graph(graph);
+}
+
+TEST_CASE("JobArenaAllocator move semantics", "[job_arena]")
+{
+    JobArenaAllocator jobs1(2, 512);
+    const JobGraph graph = jobs1.begin_graph();
+    jobs1.allocate(graph, 0, 64);
+
+    JobArenaAllocator jobs2(std::move(jobs1));
+    REQUIRE(jobs2.worker_count() == 2);
+    REQUIRE(jobs2.used(graph) >= 64);
+
+    jobs2.end_graph(graph);
+    REQUIRE(jobs2.chunk_count() == 1);
+}
@@ -0,0 +1,241 @@
+#include <catch2/catch_test_macros.hpp>
+#include "lock_free_containers.h"
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+using namespace fast_alloc;
+
+TEST_CASE("LockFreeStack is LIFO and bounded", "[lock_free]")
+{
+    LockFreeStack<int> stack(4);
+    REQUIRE(stack.capacity() == 4);
+    REQUIRE(stack.empty());
+
+    for (int i = 1; i <= 4; ++i)
+    {
+        REQUIRE(stack.try_push(i));
+    }
+    REQUIRE_FALSE(stack.try_push(5));
+
+    int value = 0;
+    for (int expected = 4; expected >= 1; --expected)
+    {
+        REQUIRE(stack.try_pop(value));
+        REQUIRE(value == expected);
+    }
+    REQUIRE_FALSE(stack.try_pop(value));
+    REQUIRE(stack.empty());
+}
+
+TEST_CASE("LockFreeStack recycles nodes", "[lock_free]")
+{
+    LockFreeStack<int> stack(2);
+
+    // Far more operations than nodes
+    for (int i = 0; i < 1000; ++i)
+    {
+        REQUIRE(stack.try_push(i));
+        REQUIRE(stack.try_push(i + 1));
+        int value = 0;
+        REQUIRE(stack.try_pop(value));
+        REQUIRE(value == i + 1);
+        REQUIRE(stack.try_pop(value));
+        REQUIRE(value == i);
+    }
+}
+
+TEST_CASE("LockFreeStack moves and destroys values", "[lock_free]")
+{
+    auto token = std::make_shared<int>(7);
+    {
+        LockFreeStack<std::shared_ptr<int>> stack(4);
+        REQUIRE(stack.try_push(token));
+        REQUIRE(stack.try_push(token));
+
+        std::shared_ptr<int> out;
+        REQUIRE(stack.try_pop(out));
+        REQUIRE(*out == 7);
+        REQUIRE(token.use_count() == 3);
+    }
+    // The element left on the stack was destroyed with it
+    REQUIRE(token.use_count() == 1);
+}
+
+TEST_CASE("LockFreeQueue is FIFO and bounded", "[lock_free]")
+{
+    LockFreeQueue<std::uint64_t> queue(3);
+    REQUIRE(queue.capacity() == 3);
+    REQUIRE(queue.empty());
+
+    REQUIRE(queue.try_push(1));
+    REQUIRE(queue.try_push(2));
+    REQUIRE(queue.try_push(3));
+    REQUIRE_FALSE(queue.try_push(4));
+
+    std::uint64_t value = 0;
+    REQUIRE(queue.try_pop(value));
+    REQUIRE(value == 1);
+
+    // The freed node is reused
+    REQUIRE(queue.try_push(4));
+
+    for (std::uint64_t expected = 2; expected <= 4; ++expected)
+    {
+        REQUIRE(queue.try_pop(value));
+        REQUIRE(value == expected);
+    }
+    REQUIRE_FALSE(queue.try_pop(value));
+    REQUIRE(queue.empty());
+}
+
+TEST_CASE("LockFreeQueue carries multi-word values", "[lock_free]")
+{
+    struct Message
+    {
+        std::uint32_t id;
+        double payload[3];
+    };
+
+    LockFreeQueue<Message> queue(8);
+    REQUIRE(queue.try_push(Message{42, {1.5, 2.5, 3.5}}));
+
+    Message out{};
+    REQUIRE(queue.try_pop(out));
+    REQUIRE(out.id == 42);
+    REQUIRE(out.payload[2] == 3.5);
+}
+
+TEST_CASE("LockFreeQueue carries values without a default constructor", "[lock_free]")
+{
+    struct Handle
+    {
+        Handle(const std::uint32_t index, const std::uint16_t generation) : index(index), generation(generation) {}
+
+        std::uint32_t index;
+        std::uint16_t generation;
+    };
+    static_assert(!std::is_default_constructible_v<Handle>);
+
+    LockFreeQueue<Handle> queue(4);
+    REQUIRE(queue.try_push(Handle{7, 3}));
+
+    Handle out{0, 0};
+    REQUIRE(queue.try_pop(out));
+    REQUIRE(out.index == 7);
+    REQUIRE(out.generation == 3);
+}
+
+namespace
+{
+    /** @brief Push 1..count from each producer while consumers pop; every value must arrive exactly once. */
+    template <typename Container>
+    void stress(Container& container, const int producers, const int consumers, const std::uint64_t count)
+    {
+        std::atomic<std::uint64_t> sum{0};
+        std::atomic<std::uint64_t> received{0};
+        const std::uint64_t total = count * static_cast<std::uint64_t>(producers);
+
+        std::vector<std::thread> threads;
+        for (int p = 0; p < producers; ++p)
+        {
+            threads.emplace_back([&]
+            {
+                for (std::uint64_t i = 1; i <= count; ++i)
+                {
+                    while (!container.try_push(i))
+                    {
+                        std::this_thread::yield();
+                    }
+                }
+            });
+        }
+        for (int c = 0; c < consumers; ++c)
+        {
+            threads.emplace_back([&]
+            {
+                std::uint64_t value = 0;
+                while (received.load(std::memory_order_relaxed) < total)
+                {
+                    if (container.try_pop(value))
+                    {
+                        sum.fetch_add(value, std::memory_order_relaxed);
+                        received.fetch_add(1, std::memory_order_relaxed);
+                    }
+                    else
+                    {
+                        std::this_thread::yield();
+                    }
+                }
+            });
+        }
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+
+        REQUIRE(received.load() == total);
+        REQUIRE(sum.load() == static_cast<std::uint64_t>(producers) * count * (count + 1) / 2);
+        REQUIRE(container.empty());
+    }
+}
+
+TEST_CASE("LockFreeStack under concurrent push and pop", "[lock_free]")
+{
+    LockFreeStack<std::uint64_t> stack(64);
+    stress(stack, 4, 4, 20000);
+}
+
+TEST_CASE("LockFreeQueue under concurrent push and pop", "[lock_free]")
+{
+    LockFreeQueue<std::uint64_t> queue(64);
+    stress(queue, 4, 4, 20000);
+}
+
+TEST_CASE("LockFreeQueue keeps per-producer order", "[lock_free]")
+{
+    LockFreeQueue<std::uint64_t> queue(32);
+    constexpr std::uint64_t count = 20000;
+
+    // Two producers tag values with their id; one consumer checks each stream is increasing
+    std::vector<std::thread> producers;
+    for (std::uint64_t id = 0; id < 2; ++id)
+    {
+        producers.emplace_back([&queue, id]
+        {
+            for (std::uint64_t i = 0; i < count; ++i)
+            {
+                while (!queue.try_push(id << 32 | i))
+                {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    std::uint64_t next[2] = {0, 0};
+    bool ordered = true;
+    for (std::uint64_t received = 0; received < 2 * count;)
+    {
+        std::uint64_t value = 0;
+        if (queue.try_pop(value))
+        {
+            const std::uint64_t id = value >> 32;
+            ordered = ordered && (value & 0xFFFFFFFF) == next[id];
+            ++next[id];
+            ++received;
+        }
+        else
+        {
+            std::this_thread::yield();
+        }
+    }
+    for (auto& producer : producers)
+    {
+        producer.join();
+    }
+
+    REQUIRE(ordered);
+}
@@ -0,0 +1,203 @@
+#include <catch2/catch_test_macros.hpp>
+#include "lru_pool.h"
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace fast_alloc;
+
+TEST_CASE("LruPool basic operations", "[lru_pool]")
+{
+    LruPool<int, std::string> cache(4);
+    REQUIRE(cache.capacity() == 4);
+    REQUIRE(cache.empty());
+
+    cache.insert_or_assign(1, "one");
+    cache.insert_or_assign(2, "two");
+    REQUIRE(cache.size() == 2);
+
+    SECTION("Find returns stored values")
+    {
+        REQUIRE(*cache.find(1) == "one");
+        REQUIRE(*cache.find(2) == "two");
+        REQUIRE(cache.find(3) == nullptr);
+        REQUIRE(cache.contains(2));
+    }
+
+    SECTION("Insert overwrites an existing key")
+    {
+        cache.insert_or_assign(1, "uno");
+        REQUIRE(cache.size() == 2);
+        REQUIRE(*cache.find(1) == "uno");
+    }
+
+    SECTION("Erase removes a key")
+    {
+        REQUIRE(cache.erase(1));
+        REQUIRE_FALSE(cache.erase(1));
+        REQUIRE(cache.find(1) == nullptr);
+        REQUIRE(*cache.find(2) == "two");
+        REQUIRE(cache.size() == 1);
+    }
+
+    SECTION("Clear removes everything")
+    {
+        cache.clear();
+        REQUIRE(cache.empty());
+        REQUIRE(cache.find(1) == nullptr);
+
+        cache.insert_or_assign(3, "three");
+        REQUIRE(*cache.find(3) == "three");
+    }
+}
+
+TEST_CASE("LruPool evicts the least recently used entry", "[lru_pool]")
+{
+    LruPool<int, int> cache(3);
+    cache.insert_or_assign(1, 10);
+    cache.insert_or_assign(2, 20);
+    cache.insert_or_assign(3, 30);
+    REQUIRE(cache.full());
+    REQUIRE(cache.least_recent() == 1);
+
+    SECTION("Oldest insertion goes first")
+    {
+        cache.insert_or_assign(4, 40);
+        REQUIRE(cache.size() == 3);
+        REQUIRE(cache.evictions() == 1);
+        REQUIRE_FALSE(cache.contains(1));
+        REQUIRE(cache.contains(4));
+    }
+
+    SECTION("Find refreshes recency")
+    {
+        REQUIRE(cache.find(1) != nullptr);
+        REQUIRE(cache.least_recent() == 2);
+
+        cache.insert_or_assign(4, 40);
+        REQUIRE(cache.contains(1));
+        REQUIRE_FALSE(cache.contains(2));
+    }
+
+    SECTION("Peek leaves recency unchanged")
+    {
+        REQUIRE(*cache.peek(1) == 10);
+        cache.insert_or_assign(4, 40);
+        REQUIRE_FALSE(cache.contains(1));
+    }
+
+    SECTION("Evicted block is reused for the new entry")
+    {
+        const int* oldest = cache.peek(1);
+        REQUIRE(&cache.insert_or_assign(4, 40) == oldest);
+    }
+
+    SECTION("Iteration runs most recent first")
+    {
+        std::vector<int> keys;
+        cache.for_each([&](const int key, int&) { keys.push_back(key); });
+        REQUIRE(keys == std::vector<int>{3, 2, 1});
+    }
+}
+
+TEST_CASE("LruPool destroys evicted and remaining values", "[lru_pool]")
+{
+    auto token = std::make_shared<int>(0);
+    {
+        LruPool<int, std::shared_ptr<int>> cache(2);
+        for (int i = 0; i < 10; ++i)
+        {
+            cache.insert_or_assign(i, token);
+        }
+        REQUIRE(token.use_count() == 3);
+        REQUIRE(cache.evictions() == 8);
+    }
+    REQUIRE(token.use_count() == 1);
+}
+
+TEST_CASE("LruPool keeps its capacity when construction throws", "[lru_pool]")
+{
+    struct ThrowingValue
+    {
+        int value;
+        bool throw_on_move;
+
+        ThrowingValue(const int v, const bool t) : value(v), throw_on_move(t) {}
+        ThrowingValue(ThrowingValue&& other) : value(other.value), throw_on_move(other.throw_on_move)
+        {
+            if (throw_on_move)
+            {
+                throw std::runtime_error("move failed");
+            }
+        }
+        ThrowingValue& operator=(ThrowingValue&&) = default;
+    };
+
+    LruPool<int, ThrowingValue> cache(2);
+
+    // Into a fresh block
+    REQUIRE_THROWS(cache.insert_or_assign(1, ThrowingValue(1, true)));
+    REQUIRE(cache.empty());
+
+    cache.insert_or_assign(1, ThrowingValue(1, false));
+    cache.insert_or_assign(2, ThrowingValue(2, false));
+    REQUIRE(cache.full());
+
+    // Into an evicted entry's block: the victim is gone, its block is not
+    REQUIRE_THROWS(cache.insert_or_assign(3, ThrowingValue(3, true)));
+    REQUIRE(cache.size() == 1);
+    REQUIRE_FALSE(cache.contains(3));
+
+    cache.insert_or_assign(4, ThrowingValue(4, false));
+    REQUIRE(cache.size() == 2);
+    REQUIRE(cache.evictions() == 1);
+}
+
+TEST_CASE("LruPool keeps lookups correct under churn", "[lru_pool]")
+{
+    // Colliding hashes exercise probing and backward-shift erase
+    struct CollidingHash
+    {
+        std::size_t operator()(const int key) const noexcept { return static_cast<std::size_t>(key % 4); }
+    };
+
+    LruPool<int, int, CollidingHash> cache(16);
+    for (int i = 0; i < 200; ++i)
+    {
+        cache.insert_or_assign(i, i * 2);
+        if (i % 3 == 0)
+        {
+            cache.erase(i - 5);
+        }
+
+        // Everything cached must still be found with its own value
+        cache.for_each([&](const int key, const int value) { REQUIRE(value == key * 2); });
+        std::size_t found = 0;
+        for (int key = 0; key <= i; ++key)
+        {
+            if (const int* value = cache.peek(key))
+            {
+                REQUIRE(*value == key * 2);
+                ++found;
+            }
+        }
+        REQUIRE(found == cache.size());
+    }
+}
+
+TEST_CASE("LruPool move", "[lru_pool]")
+{
+    LruPool<int, int> cache(4);
+    cache.insert_or_assign(1, 10);
+
+    LruPool<int, int> moved(std::move(cache));
+    REQUIRE(*moved.find(1) == 10);
+    REQUIRE(moved.size() == 1);
+
+    LruPool<int, int> assigned(2);
+    assigned.insert_or_assign(2, 20);
+    assigned = std::move(moved);
+    REQUIRE(*assigned.find(1) == 10);
+    REQUIRE_FALSE(assigned.contains(2));
+}
@@ -0,0 +1,239 @@
+#include <catch2/catch_test_macros.hpp>
+#include "memory_budget.h"
+#include "pool_allocator.h"
+#include "stack_allocator.h"
+#include "threadsafe_pool_allocator.h"
+#include "tiny_pool_allocator.h"
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace fast_alloc;
+
+TEST_CASE("MemoryBudget charges propagate to ancestors", "[memory_budget]")
+{
+    MemoryBudget process("process");
+    MemoryBudget audio("audio", &process);
+    MemoryBudget voices("voices", &audio);
+    MemoryBudget render("render", &process);
+
+    REQUIRE(process.children().size() == 2);
+    REQUIRE(voices.parent() == &audio);
+
+    voices.charge(1000);
+    render.charge(500);
+
+    // Batched charges still show up in every ancestor's usage
+    REQUIRE(voices.used() == 1000);
+    REQUIRE(audio.used() == 1000);
+    REQUIRE(process.used() == 1500);
+
+    voices.release(1000);
+    REQUIRE(audio.used() == 0);
+    REQUIRE(process.used() == 500);
+
+    render.release(500);
+}
+
+TEST_CASE("MemoryBudget batches propagate automatically", "[memory_budget]")
+{
+    MemoryBudget process("process");
+    MemoryBudget child("child", &process);
+
+    child.charge(1000);
+    REQUIRE(process.peak() == 0); // Still batched in this thread's shard
+
+    child.charge(MemoryBudget::batch_size);
+    REQUIRE(process.peak() == MemoryBudget::batch_size + 1000);
+
+    child.release(MemoryBudget::batch_size + 1000);
+    REQUIRE(process.used() == 0);
+}
+
+TEST_CASE("MemoryBudget soft limit fires once per crossing", "[memory_budget]")
+{
+    MemoryBudget budget("budget", nullptr, 100 * 1024);
+
+    int soft_events = 0;
+    budget.set_callback([&](const MemoryBudget& node, const BudgetEvent event)
+    {
+        REQUIRE(&node == &budget);
+        if (event == BudgetEvent::SoftLimitExceeded) ++soft_events;
+    });
+
+    budget.charge(128 * 1024);
+    REQUIRE(soft_events == 1);
+
+    budget.charge(64 * 1024);
+    REQUIRE(soft_events == 1); // Still over - no repeat
+
+    budget.release(192 * 1024);
+    budget.charge(128 * 1024);
+    REQUIRE(soft_events == 2); // Crossed again
+
+    budget.release(128 * 1024);
+}
+
+TEST_CASE("MemoryBudget hard limit refuses charges anywhere up the tree", "[memory_budget]")
+{
+    MemoryBudget process("process", nullptr, MemoryBudget::unlimited, 4096);
+    MemoryBudget child("child", &process);
+
+    const MemoryBudget* refused_by = nullptr;
+    process.set_callback([&](const MemoryBudget& node, const BudgetEvent event)
+    {
+        if (event == BudgetEvent::HardLimitExceeded) refused_by = &node;
+    });
+
+    REQUIRE(child.try_charge(3000));
+    REQUIRE_FALSE(child.try_charge(2000));
+    REQUIRE(refused_by == &process);
+    REQUIRE(child.try_charge(1000));
+
+    child.release(4000);
+}
+
+TEST_CASE("MemoryBudget destroying a child returns its usage", "[memory_budget]")
+{
+    MemoryBudget process("process");
+    {
+        MemoryBudget temporary("temporary", &process);
+        temporary.charge(700);
+    }
+
+    REQUIRE(process.children().empty());
+    REQUIRE(process.used() == 0);
+}
+
+TEST_CASE("MemoryBudget concurrent charges are exact", "[memory_budget]")
+{
+    constexpr int thread_count = 4;
+    constexpr int iterations = 10000;
+
+    MemoryBudget process("process");
+    MemoryBudget workers("workers", &process);
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < thread_count; ++t)
+    {
+        threads.emplace_back([&]
+        {
+            for (int i = 0; i < iterations; ++i)
+            {
+                workers.charge(64);
+                if (i % 2 == 0) workers.release(64);
+            }
+        });
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    REQUIRE(process.used() == thread_count * (iterations / 2) * 64);
+
+    workers.release(thread_count * (iterations / 2) * 64);
+}
+
+TEST_CASE("BudgetedAllocator charges allocations", "[memory_budget]")
+{
+    MemoryBudget budget("pools", nullptr, MemoryBudget::unlimited, 256);
+
+    SECTION("Pools are charged whole blocks")
+    {
+        PoolAllocator pool(64, 8);
+        BudgetedAllocator charged(pool, budget);
+
+        void* a = charged.allocate(10);
+        REQUIRE(a != nullptr);
+        REQUIRE(charged.outstanding() == 64);
+
+        std::vector<void*> more;
+        while (void* ptr = charged.allocate(64))
+        {
+            more.push_back(ptr);
+        }
+
+        // Hard limit of 4 blocks stops allocation before the pool runs out
+        REQUIRE(more.size() == 3);
+        REQUIRE(pool.allocated() == 4);
+
+        charged.deallocate(a, 10);
+        for (void* ptr : more)
+        {
+            charged.deallocate(ptr, 64);
+        }
+        REQUIRE(charged.outstanding() == 0);
+        REQUIRE(budget.used() == 0);
+    }
+
+    SECTION("Tiny pools are charged whole blocks")
+    {
+        TinyPoolAllocator tiny(16, 64);
+        BudgetedAllocator charged(tiny, budget);
+
+        void* a = charged.allocate(10, 1);
+        REQUIRE(a != nullptr);
+        REQUIRE(charged.outstanding() == 16);
+        REQUIRE(charged.allocate(32) == nullptr); // Larger than a block
+
+        charged.deallocate(a, 10, 1);
+        REQUIRE(charged.outstanding() == 0);
+        REQUIRE(budget.used() == 0);
+        REQUIRE(tiny.allocated() == 0);
+    }
+
+    SECTION("Arenas release their charge on reset")
+    {
+        StackAllocator stack(1024);
+        BudgetedAllocator charged(stack, budget);
+
+        REQUIRE(charged.allocate(100) != nullptr);
+        REQUIRE(charged.allocate(100) != nullptr);
+        REQUIRE(charged.allocate(100) == nullptr); // Over the hard limit
+        REQUIRE(budget.used() == 200);
+
+        charged.reset();
+        REQUIRE(budget.used() == 0);
+        REQUIRE(stack.used() == 0);
+    }
+}
+
+TEST_CASE("BudgetedAllocator over a thread-safe pool is shared across threads", "[memory_budget]")
+{
+    constexpr int thread_count = 4;
+    constexpr int iterations = 10000;
+
+    MemoryBudget budget("shared");
+    ThreadSafePoolAllocator pool(64, thread_count * 4);
+    BudgetedAllocator charged(pool, budget);
+    std::atomic<int> failures{0};
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < thread_count; ++t)
+    {
+        threads.emplace_back([&]
+        {
+            for (int i = 0; i < iterations; ++i)
+            {
+                void* ptr = charged.allocate(64);
+                if (!ptr)
+                {
+                    failures.fetch_add(1, std::memory_order_relaxed);
+                    continue;
+                }
+                charged.deallocate(ptr, 64);
+            }
+        });
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    REQUIRE(failures.load() == 0);
+    REQUIRE(charged.outstanding() == 0);
+    REQUIRE(budget.used() == 0);
+}
@@ -0,0 +1,160 @@
+#include <catch2/catch_test_macros.hpp>
+#include "mirrored_ring_buffer.h"
+#include <cstdint>
+#include <cstring>
+#include <thread>
+
+using namespace fast_alloc;
+
+TEST_CASE("MirroredRingBuffer maps the same memory twice", "[mirrored_ring]")
+{
+    MirroredRingBuffer ring(4096);
+    REQUIRE(ring.data() != nullptr);
+    REQUIRE(ring.capacity() >= 4096);
+
+    auto* first = static_cast<unsigned char*>(ring.data());
+    unsigned char* second = first + ring.capacity();
+
+    first[0] = 0x11;
+    REQUIRE(second[0] == 0x11);
+    second[ring.capacity() - 1] = 0x22;
+    REQUIRE(first[ring.capacity() - 1] == 0x22);
+}
+
+TEST_CASE("MirroredRingBuffer stream operations", "[mirrored_ring]")
+{
+    MirroredRingBuffer ring(4096);
+    const std::size_t capacity = ring.capacity();
+    std::size_t size = 0;
+
+    REQUIRE(ring.empty());
+    REQUIRE(ring.peek(&size) == nullptr);
+    REQUIRE(size == 0);
+
+    SECTION("Committed bytes are readable in order")
+    {
+        void* space = ring.reserve(8);
+        REQUIRE(space != nullptr);
+        std::memcpy(space, "abcdefgh", 8);
+        ring.commit(5);
+
+        const void* bytes = ring.peek(&size);
+        REQUIRE(bytes != nullptr);
+        REQUIRE(size == 5);
+        REQUIRE(std::memcmp(bytes, "abcde", 5) == 0);
+
+        ring.consume(2);
+        bytes = ring.peek(&size);
+        REQUIRE(size == 3);
+        REQUIRE(std::memcmp(bytes, "cde", 3) == 0);
+    }
+
+    SECTION("Minimum size waits for a whole record")
+    {
+        std::memcpy(ring.reserve(4), "head", 4);
+        ring.commit(4);
+        REQUIRE(ring.peek(&size, 8) == nullptr);
+        REQUIRE(size == 4);
+
+        std::memcpy(ring.reserve(4), "tail", 4);
+        ring.commit(4);
+        REQUIRE(ring.peek(&size, 8) != nullptr);
+        REQUIRE(size == 8);
+    }
+
+    SECTION("Full ring rejects reservations")
+    {
+        REQUIRE(ring.reserve(capacity) != nullptr);
+        ring.commit(capacity);
+        REQUIRE(ring.reserve(1) == nullptr);
+
+        REQUIRE(ring.peek(&size) != nullptr);
+        ring.consume(16);
+        REQUIRE(ring.reserve(16) != nullptr);
+        REQUIRE(ring.reserve(17) == nullptr);
+    }
+
+    SECTION("Records straddling the wrap point stay contiguous")
+    {
+        // Move the head to 100 bytes before the end
+        const std::size_t offset = capacity - 100;
+        REQUIRE(ring.reserve(offset) != nullptr);
+        ring.commit(offset);
+        REQUIRE(ring.peek(&size) != nullptr);
+        ring.consume(offset);
+
+        auto* record = static_cast<std::uint32_t*>(ring.reserve(400));
+        REQUIRE(record != nullptr);
+        for (std::uint32_t i = 0; i < 100; ++i)
+        {
+            record[i] = i;
+        }
+        ring.commit(400);
+
+        const auto* read = static_cast<const std::uint32_t*>(ring.peek(&size));
+        REQUIRE(read == record);
+        REQUIRE(size == 400);
+        for (std::uint32_t i = 0; i < 100; ++i)
+        {
+            REQUIRE(read[i] == i);
+        }
+
+        // The part past the end really is at the start of the buffer
+        std::uint32_t wrapped = 0;
+        std::memcpy(&wrapped, ring.data(), sizeof(wrapped));
+        REQUIRE(wrapped == 25);
+    }
+}
+
+TEST_CASE("MirroredRingBuffer streams records between threads", "[mirrored_ring]")
+{
+    MirroredRingBuffer ring(4096);
+    constexpr std::uint32_t count = 50000;
+
+    // Length-prefixed records of varying size
+    std::thread producer([&ring]
+    {
+        for (std::uint32_t i = 0; i < count; ++i)
+        {
+            const std::uint32_t words = 1 + i % 61;
+            const std::size_t bytes = sizeof(std::uint32_t) * (words + 1);
+            std::uint32_t* record;
+            while (!(record = static_cast<std::uint32_t*>(ring.reserve(bytes))))
+            {
+                std::this_thread::yield();
+            }
+            record[0] = words;
+            for (std::uint32_t w = 1; w <= words; ++w)
+            {
+                record[w] = i;
+            }
+            ring.commit(bytes);
+        }
+    });
+
+    bool intact = true;
+    for (std::uint32_t i = 0; i < count;)
+    {
+        std::size_t size = 0;
+        const auto* bytes = static_cast<const std::uint32_t*>(ring.peek(&size, sizeof(std::uint32_t)));
+        if (!bytes || !ring.peek(&size, sizeof(std::uint32_t) * (bytes[0] + 1)))
+        {
+            std::this_thread::yield(); // Header or body not committed yet
+            continue;
+        }
+
+        // Parse in place: no record is ever split
+        const std::uint32_t words = bytes[0];
+        intact = intact && words == 1 + i % 61;
+        for (std::uint32_t w = 1; w <= words; ++w)
+        {
+            intact = intact && bytes[w] == i;
+        }
+        ring.consume(sizeof(std::uint32_t) * (words + 1));
+        ++i;
+    }
+    producer.join();
+
+    REQUIRE(intact);
+    REQUIRE(ring.empty());
+}
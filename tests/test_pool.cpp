@@ -1,5 +1,6 @@
 #include <catch2/catch_test_macros.hpp>
 #include "pool_allocator.h"
+#include <cstring>
 
 using namespace fast_alloc;
 
@@ -146,3 +147,338 @@ TEST_CASE("PoolAllocator interleaved operations", "[pool]")
     pool.deallocate(p3);
     pool.deallocate(p4);
 }
+
+TEST_CASE("PoolAllocator custom alignment", "[pool]")
+{
+    SECTION("Cache line alignment rounds stride up")
+    {
+        PoolAllocator pool(24, 8, 64);
+        REQUIRE(pool.block_size() == 24);
+        REQUIRE(pool.block_stride() == 64);
+        REQUIRE(pool.alignment() == 64);
+
+        void* ptrs[8];
+        for (auto& ptr : ptrs)
+        {
+            ptr = pool.allocate();
+            REQUIRE(ptr != nullptr);
+            REQUIRE(reinterpret_cast<std::uintptr_t>(ptr) % 64 == 0);
+        }
+
+        for (auto& ptr : ptrs)
+        {
+            pool.deallocate(ptr);
+        }
+        REQUIRE(pool.allocated() == 0);
+    }
+
+    SECTION("Page alignment")
+    {
+        PoolAllocator pool(100, 4, 4096);
+        REQUIRE(pool.block_stride() == 4096);
+
+        void* p1 = pool.allocate();
+        void* p2 = pool.allocate();
+        REQUIRE(reinterpret_cast<std::uintptr_t>(p1) % 4096 == 0);
+        REQUIRE(reinterpret_cast<std::uintptr_t>(p2) % 4096 == 0);
+
+        pool.deallocate(p1);
+        pool.deallocate(p2);
+    }
+
+    SECTION("Block size already a multiple of alignment")
+    {
+        const PoolAllocator pool(128, 4, 128);
+        REQUIRE(pool.block_stride() == 128);
+    }
+
+    SECTION("Alignment survives move")
+    {
+        PoolAllocator pool1(32, 4, 128);
+        PoolAllocator pool2(std::move(pool1));
+        REQUIRE(pool2.alignment() == 128);
+
+        void* ptr = pool2.allocate();
+        REQUIRE(reinterpret_cast<std::uintptr_t>(ptr) % 128 == 0);
+        pool2.deallocate(ptr);
+    }
+}
+
+TEST_CASE("PoolAllocator locality optimisation", "[pool]")
+{
+    constexpr std::size_t count = 16;
+    PoolAllocator pool(64, count);
+
+    void* ptrs[count];
+    for (auto& ptr : ptrs)
+    {
+        ptr = pool.allocate();
+    }
+
+    // Free in a scrambled order so the LIFO list is out of address order
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        pool.deallocate(ptrs[(i * 7) % count]);
+    }
+
+    SECTION("Manual rebuild hands out blocks in address order")
+    {
+        pool.optimize_locality();
+        REQUIRE(pool.allocated() == 0);
+
+        void* previous = pool.allocate();
+        for (std::size_t i = 1; i < count; ++i)
+        {
+            void* next = pool.allocate();
+            REQUIRE(next != nullptr);
+            REQUIRE(static_cast<std::byte*>(next) == static_cast<std::byte*>(previous) + pool.block_stride());
+            previous = next;
+        }
+        REQUIRE(pool.is_full());
+    }
+
+    SECTION("Rebuild preserves allocated blocks")
+    {
+        void* a = pool.allocate();
+        void* b = pool.allocate();
+        pool.optimize_locality();
+
+        for (std::size_t i = 2; i < count; ++i)
+        {
+            void* ptr = pool.allocate();
+            REQUIRE(ptr != nullptr);
+            REQUIRE(ptr != a);
+            REQUIRE(ptr != b);
+        }
+        REQUIRE(pool.allocate() == nullptr);
+    }
+}
+
+TEST_CASE("PoolAllocator automatic locality interval", "[pool]")
+{
+    PoolAllocator pool(64, 4);
+    pool.set_locality_interval(4);
+    REQUIRE(pool.locality_interval() == 4);
+
+    void* p0 = pool.allocate();
+    void* p1 = pool.allocate();
+    void* p2 = pool.allocate();
+    void* p3 = pool.allocate();
+
+    pool.deallocate(p0);
+    pool.deallocate(p2);
+    pool.deallocate(p1);
+    pool.deallocate(p3); // Fourth deallocation triggers the rebuild
+
+    REQUIRE(pool.allocate() == p0);
+    REQUIRE(pool.allocate() == p1);
+    REQUIRE(pool.allocate() == p2);
+    REQUIRE(pool.allocate() == p3);
+}
+
+TEST_CASE("PoolAllocator contiguous runs", "[pool]")
+{
+    PoolAllocator pool(64, 8);
+
+    SECTION("Run of adjacent blocks")
+    {
+        void* run = pool.allocate_contiguous(3);
+        REQUIRE(run != nullptr);
+        REQUIRE(pool.allocated() == 3);
+
+        // Single allocations never overlap the run
+        const auto* run_begin = static_cast<std::byte*>(run);
+        const auto* run_end = run_begin + 3 * pool.block_stride();
+        for (std::size_t i = 0; i < 5; ++i)
+        {
+            const auto* ptr = static_cast<std::byte*>(pool.allocate());
+            REQUIRE(ptr != nullptr);
+            REQUIRE((ptr < run_begin || ptr >= run_end));
+        }
+        REQUIRE(pool.is_full());
+        REQUIRE(pool.allocate_contiguous(2) == nullptr);
+    }
+
+    SECTION("Fails when free blocks are not adjacent")
+    {
+        void* ptrs[8];
+        for (auto& ptr : ptrs)
+        {
+            ptr = pool.allocate();
+        }
+
+        // Free every other block: four free blocks, no two adjacent
+        pool.optimize_locality();
+        for (std::size_t i = 0; i < 8; i += 2)
+        {
+            pool.deallocate(ptrs[i]);
+        }
+        REQUIRE(pool.allocate_contiguous(2) == nullptr);
+        REQUIRE(pool.allocated() == 4);
+
+        for (std::size_t i = 1; i < 8; i += 2)
+        {
+            pool.deallocate(ptrs[i]);
+        }
+        REQUIRE(pool.allocate_contiguous(8) != nullptr);
+        REQUIRE(pool.is_full());
+    }
+
+    SECTION("Run returns to the pool")
+    {
+        void* run = pool.allocate_contiguous(8);
+        REQUIRE(run != nullptr);
+        REQUIRE(pool.is_full());
+
+        pool.deallocate_contiguous(run, 8);
+        REQUIRE(pool.allocated() == 0);
+
+        // Freed in reverse, so single allocations come back in address order
+        REQUIRE(pool.allocate() == run);
+    }
+
+    SECTION("Too long for the pool")
+    {
+        REQUIRE(pool.allocate_contiguous(9) == nullptr);
+        REQUIRE(pool.allocated() == 0);
+    }
+
+    SECTION("Other free blocks keep their LIFO order")
+    {
+        void* ptrs[8];
+        for (auto& ptr : ptrs)
+        {
+            ptr = pool.allocate();
+        }
+
+        // Free list: 2, 1, 7, 3
+        pool.deallocate(ptrs[3]);
+        pool.deallocate(ptrs[7]);
+        pool.deallocate(ptrs[1]);
+        pool.deallocate(ptrs[2]);
+
+        REQUIRE(pool.allocate_contiguous(2) == ptrs[1]);
+        REQUIRE(pool.allocate() == ptrs[7]);
+        REQUIRE(pool.allocate() == ptrs[3]);
+        REQUIRE(pool.is_full());
+    }
+}
+
+TEST_CASE("PoolAllocator out-of-band tracking", "[pool]")
+{
+    PoolAllocator pool(64, 8, alignof(std::max_align_t), FreeSlotTracking::OutOfBand);
+    REQUIRE(pool.tracking() == FreeSlotTracking::OutOfBand);
+
+    SECTION("Freed blocks are never written")
+    {
+        void* ptrs[8];
+        for (auto& ptr : ptrs)
+        {
+            ptr = pool.allocate();
+            REQUIRE(ptr != nullptr);
+            std::memset(ptr, 0xAB, 64);
+        }
+        REQUIRE(pool.is_full());
+        REQUIRE(pool.allocate() == nullptr);
+
+        for (auto& ptr : ptrs)
+        {
+            pool.deallocate(ptr);
+        }
+        REQUIRE(pool.allocated() == 0);
+
+        for (auto& ptr : ptrs)
+        {
+            const auto* bytes = static_cast<unsigned char*>(ptr);
+            for (std::size_t i = 0; i < 64; ++i)
+            {
+                REQUIRE(bytes[i] == 0xAB);
+            }
+        }
+    }
+
+    SECTION("Blocks are handed out in address order and reused LIFO")
+    {
+        auto* p0 = static_cast<std::byte*>(pool.allocate());
+        auto* p1 = static_cast<std::byte*>(pool.allocate());
+        REQUIRE(p1 == p0 + pool.block_stride());
+
+        pool.deallocate(p0);
+        REQUIRE(pool.allocate() == p0);
+
+        pool.deallocate(p0);
+        pool.deallocate(p1);
+    }
+
+    SECTION("Locality rebuild and contiguous runs")
+    {
+        void* ptrs[8];
+        for (auto& ptr : ptrs)
+        {
+            ptr = pool.allocate();
+        }
+        for (std::size_t i = 0; i < 8; ++i)
+        {
+            pool.deallocate(ptrs[(i * 3) % 8]);
+        }
+
+        pool.optimize_locality();
+        REQUIRE(pool.allocate() == ptrs[0]);
+        REQUIRE(pool.allocate() == ptrs[1]);
+
+        void* run = pool.allocate_contiguous(6);
+        REQUIRE(run == ptrs[2]);
+        REQUIRE(pool.is_full());
+
+        pool.deallocate_contiguous(run, 6);
+        pool.deallocate(ptrs[0]);
+        pool.deallocate(ptrs[1]);
+        REQUIRE(pool.allocated() == 0);
+    }
+
+    SECTION("Contiguous runs leave the side stack order alone")
+    {
+        void* ptrs[8];
+        for (auto& ptr : ptrs)
+        {
+            ptr = pool.allocate();
+        }
+
+        pool.deallocate(ptrs[3]);
+        pool.deallocate(ptrs[7]);
+        pool.deallocate(ptrs[1]);
+        pool.deallocate(ptrs[2]);
+
+        REQUIRE(pool.allocate_contiguous(2) == ptrs[1]);
+        REQUIRE(pool.allocate() == ptrs[7]);
+        REQUIRE(pool.allocate() == ptrs[3]);
+        REQUIRE(pool.is_full());
+    }
+
+    SECTION("Move keeps the side stack")
+    {
+        void* ptr = pool.allocate();
+        PoolAllocator moved(std::move(pool));
+        REQUIRE(moved.tracking() == FreeSlotTracking::OutOfBand);
+        REQUIRE(moved.allocated() == 1);
+
+        moved.deallocate(ptr);
+        REQUIRE(moved.allocate() == ptr);
+        moved.deallocate(ptr);
+    }
+}
+
+TEST_CASE("PoolAllocator out-of-band tracking allows tiny blocks", "[pool]")
+{
+    PoolAllocator pool(2, 4, alignof(void*), FreeSlotTracking::OutOfBand);
+    REQUIRE(pool.block_stride() == alignof(void*));
+
+    void* a = pool.allocate();
+    void* b = pool.allocate();
+    REQUIRE(a != nullptr);
+    REQUIRE(b != nullptr);
+
+    pool.deallocate(a);
+    pool.deallocate(b);
+    REQUIRE(pool.allocated() == 0);
+}
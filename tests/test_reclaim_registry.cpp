@@ -0,0 +1,145 @@
+#include <catch2/catch_test_macros.hpp>
+#include "reclaim_registry.h"
+#include "freelist_allocator.h"
+#include "pool_allocator.h"
+#include <vector>
+
+using namespace fast_alloc;
+
+TEST_CASE("ReclaimRegistry runs callbacks by priority until satisfied", "[reclaim]")
+{
+    ReclaimRegistry registry;
+    std::vector<int> order;
+
+    registry.add([&](std::size_t) { order.push_back(2); return std::size_t{100}; }, 5);
+    registry.add([&](std::size_t) { order.push_back(1); return std::size_t{100}; }, 1);
+    const auto late = registry.add([&](std::size_t) { order.push_back(3); return std::size_t{100}; }, 5);
+    REQUIRE(registry.size() == 3);
+
+    SECTION("Stops once enough is freed")
+    {
+        REQUIRE(registry.reclaim(150) == 200);
+        REQUIRE(order == std::vector<int>{1, 2});
+    }
+
+    SECTION("Runs everything when nothing suffices")
+    {
+        REQUIRE(registry.reclaim(1000) == 300);
+        REQUIRE(order == std::vector<int>{1, 2, 3});
+    }
+
+    SECTION("Removed callbacks no longer run")
+    {
+        registry.remove(late);
+        REQUIRE(registry.size() == 2);
+        REQUIRE(registry.reclaim(1000) == 200);
+    }
+}
+
+TEST_CASE("ReclaimRegistry does not recurse from callbacks", "[reclaim]")
+{
+    ReclaimRegistry registry;
+    std::size_t nested = SIZE_MAX;
+
+    registry.add([&](std::size_t) { nested = registry.reclaim(10); return std::size_t{10}; });
+
+    REQUIRE(registry.reclaim(10) == 10);
+    REQUIRE(nested == 0);
+}
+
+TEST_CASE("PoolAllocator reclaims before failing", "[reclaim]")
+{
+    PoolAllocator pool(64, 4);
+    ReclaimRegistry registry;
+    pool.set_reclaim_registry(&registry);
+
+    // A cache holding every block until asked to drop one
+    std::vector<void*> cache;
+    for (int i = 0; i < 4; ++i)
+    {
+        cache.push_back(pool.allocate());
+    }
+
+    int calls = 0;
+    registry.add([&](std::size_t)
+    {
+        ++calls;
+        if (cache.empty()) return std::size_t{0};
+        pool.deallocate(cache.back());
+        cache.pop_back();
+        return pool.block_size();
+    });
+
+    void* ptr = pool.allocate();
+    REQUIRE(ptr != nullptr);
+    REQUIRE(calls == 1);
+    REQUIRE(cache.size() == 3);
+
+    // Nothing left to drop: reclaim runs, frees nothing, allocate fails
+    for (void* cached : cache)
+    {
+        pool.deallocate(cached);
+    }
+    cache.clear();
+    for (int i = 0; i < 3; ++i)
+    {
+        REQUIRE(pool.allocate() != nullptr);
+    }
+    REQUIRE(pool.allocate() == nullptr);
+    REQUIRE(calls == 2);
+    REQUIRE(pool.reclaim_registry() == &registry);
+}
+
+TEST_CASE("PoolAllocator without registry fails immediately", "[reclaim]")
+{
+    PoolAllocator pool(64, 1);
+    void* ptr = pool.allocate();
+    REQUIRE(pool.allocate() == nullptr);
+    pool.deallocate(ptr);
+}
+
+TEST_CASE("FreeListAllocator reclaims before failing", "[reclaim]")
+{
+    FreeListAllocator allocator(4096);
+    ReclaimRegistry registry;
+    allocator.set_reclaim_registry(&registry);
+
+    void* cached = allocator.allocate(3000);
+    REQUIRE(cached != nullptr);
+
+    std::size_t wanted = 0;
+    registry.add([&](const std::size_t bytes)
+    {
+        wanted = bytes;
+        if (!cached) return std::size_t{0};
+        allocator.deallocate(cached);
+        cached = nullptr;
+        return std::size_t{3000};
+    });
+
+    void* ptr = allocator.allocate(2000);
+    REQUIRE(ptr != nullptr);
+    REQUIRE(wanted >= 2000);
+    REQUIRE(cached == nullptr);
+
+    allocator.deallocate(ptr);
+}
+
+#ifdef __linux__
+TEST_CASE("ReclaimRegistry polls process RSS", "[reclaim]")
+{
+    REQUIRE(ReclaimRegistry::resident_bytes() > 0);
+
+    ReclaimRegistry registry;
+    std::size_t wanted = 0;
+    registry.add([&](const std::size_t bytes) { wanted = bytes; return bytes; });
+
+    REQUIRE(registry.poll() == 0); // No thresholds set
+
+    registry.set_rss_threshold(1); // Any process is above one byte
+    REQUIRE(registry.poll() > 0);
+    REQUIRE(wanted > 0);
+
+    registry.set_rss_threshold(0);
+}
+#endif
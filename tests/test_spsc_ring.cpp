@@ -0,0 +1,221 @@
+#include <catch2/catch_test_macros.hpp>
+#include "spsc_ring_allocator.h"
+#include <cstdint>
+#include <cstring>
+#include <thread>
+
+using namespace fast_alloc;
+
+TEST_CASE("SpscRingAllocator basic operations", "[spsc_ring]")
+{
+    SpscRingAllocator ring(1024);
+    REQUIRE(ring.capacity() == 1024);
+    REQUIRE(ring.empty());
+    REQUIRE(ring.front() == nullptr);
+
+    SECTION("Records are consumed in order")
+    {
+        for (std::uint32_t i = 0; i < 3; ++i)
+        {
+            void* record = ring.reserve(sizeof(std::uint32_t) * (i + 1));
+            REQUIRE(record != nullptr);
+            std::memcpy(record, &i, sizeof(i));
+            ring.commit();
+        }
+        REQUIRE_FALSE(ring.empty());
+
+        for (std::uint32_t i = 0; i < 3; ++i)
+        {
+            std::size_t size = 0;
+            const void* record = ring.front(&size);
+            REQUIRE(record != nullptr);
+            REQUIRE(size == sizeof(std::uint32_t) * (i + 1));
+
+            std::uint32_t value = 0;
+            std::memcpy(&value, record, sizeof(value));
+            REQUIRE(value == i);
+            ring.release();
+        }
+        REQUIRE(ring.front() == nullptr);
+        REQUIRE(ring.empty());
+    }
+
+    SECTION("Uncommitted records are invisible")
+    {
+        REQUIRE(ring.reserve(32) != nullptr);
+        REQUIRE(ring.front() == nullptr);
+        ring.commit();
+        REQUIRE(ring.front() != nullptr);
+    }
+
+    SECTION("Front repeats until released")
+    {
+        ring.reserve(8);
+        ring.commit();
+        REQUIRE(ring.front() == ring.front());
+    }
+
+    SECTION("Alignment is honoured")
+    {
+        for (std::size_t alignment = 1; alignment <= SpscRingAllocator::max_alignment; alignment *= 2)
+        {
+            void* record = ring.reserve(24, alignment);
+            REQUIRE(record != nullptr);
+            REQUIRE(reinterpret_cast<std::uintptr_t>(record) % alignment == 0);
+            ring.commit();
+            REQUIRE(ring.front() == record);
+            ring.release();
+        }
+    }
+
+    SECTION("Commit trims the record")
+    {
+        REQUIRE(ring.reserve(256) != nullptr);
+        ring.commit(10);
+        std::size_t size = 0;
+        REQUIRE(ring.front(&size) != nullptr);
+        REQUIRE(size == 10);
+        REQUIRE(ring.used() == SpscRingAllocator::header_size + 16);
+    }
+}
+
+TEST_CASE("SpscRingAllocator capacity and wrapping", "[spsc_ring]")
+{
+    SpscRingAllocator ring(256);
+
+    SECTION("Full ring rejects reservations until released")
+    {
+        // 48 bytes of data plus a 16-byte header: exactly four records
+        for (int i = 0; i < 4; ++i)
+        {
+            REQUIRE(ring.reserve(48) != nullptr);
+            ring.commit();
+        }
+        REQUIRE(ring.used() == 256);
+        REQUIRE(ring.reserve(1) == nullptr);
+
+        REQUIRE(ring.front() != nullptr);
+        ring.release();
+        REQUIRE(ring.reserve(48) != nullptr);
+        ring.commit();
+    }
+
+    SECTION("Records that would straddle the end wrap with a skip marker")
+    {
+        // Leave 64 bytes at the end, then free the front
+        for (int i = 0; i < 3; ++i)
+        {
+            ring.reserve(48);
+            ring.commit();
+        }
+        REQUIRE(ring.front() != nullptr);
+        ring.release();
+        REQUIRE(ring.front() != nullptr);
+        ring.release();
+
+        // Needs 112 bytes: does not fit in the remaining 64, so it goes to the front
+        void* wrapped = ring.reserve(96);
+        REQUIRE(wrapped != nullptr);
+        std::memset(wrapped, 0xAB, 96);
+        ring.commit();
+
+        REQUIRE(ring.front() != nullptr);
+        ring.release(); // Third small record
+
+        std::size_t size = 0;
+        REQUIRE(ring.front(&size) == wrapped); // Skip marker stepped over
+        REQUIRE(size == 96);
+        ring.release();
+        REQUIRE(ring.empty());
+    }
+
+    SECTION("Oversized records are rejected")
+    {
+        REQUIRE(ring.max_record_size() == 112);
+        REQUIRE(ring.max_record_size(64) == 64);
+        REQUIRE(ring.reserve(113) == nullptr);
+        REQUIRE(ring.reserve(65, 64) == nullptr);
+        REQUIRE(ring.reserve(112) != nullptr);
+    }
+}
+
+TEST_CASE("SpscRingAllocator accepts the largest record wherever the head is", "[spsc_ring]")
+{
+    SpscRingAllocator ring(1024);
+
+    for (std::size_t lead = 16; lead <= ring.max_record_size(); lead += 16)
+    {
+        // Move head and tail together, mid-buffer
+        REQUIRE(ring.reserve(lead) != nullptr);
+        ring.commit();
+        REQUIRE(ring.front() != nullptr);
+        ring.release();
+        REQUIRE(ring.empty());
+
+        for (const std::size_t alignment : {std::size_t{16}, std::size_t{64}})
+        {
+            const std::size_t largest = ring.max_record_size(alignment);
+            void* record = ring.reserve(largest, alignment);
+            REQUIRE(record != nullptr);
+            std::memset(record, 0x5A, largest);
+            ring.commit();
+
+            std::size_t size = 0;
+            REQUIRE(ring.front(&size) == record);
+            REQUIRE(size == largest);
+            ring.release();
+            REQUIRE(ring.empty());
+        }
+    }
+}
+
+TEST_CASE("SpscRingAllocator transfers records between threads", "[spsc_ring]")
+{
+    SpscRingAllocator ring(4096);
+    constexpr std::uint32_t count = 100000;
+
+    std::thread producer([&ring]
+    {
+        for (std::uint32_t i = 0; i < count; ++i)
+        {
+            // Variable sizes force regular wrapping
+            const std::size_t size = sizeof(std::uint32_t) * (1 + i % 37);
+            void* record;
+            while (!(record = ring.reserve(size)))
+            {
+                std::this_thread::yield();
+            }
+            auto* words = static_cast<std::uint32_t*>(record);
+            for (std::size_t w = 0; w < size / sizeof(std::uint32_t); ++w)
+            {
+                words[w] = i;
+            }
+            ring.commit();
+        }
+    });
+
+    bool intact = true;
+    for (std::uint32_t i = 0; i < count;)
+    {
+        std::size_t size = 0;
+        const void* record = ring.front(&size);
+        if (!record)
+        {
+            std::this_thread::yield();
+            continue;
+        }
+
+        const auto* words = static_cast<const std::uint32_t*>(record);
+        intact = intact && size == sizeof(std::uint32_t) * (1 + i % 37);
+        for (std::size_t w = 0; w < size / sizeof(std::uint32_t); ++w)
+        {
+            intact = intact && words[w] == i;
+        }
+        ring.release();
+        ++i;
+    }
+    producer.join();
+
+    REQUIRE(intact);
+    REQUIRE(ring.empty());
+}
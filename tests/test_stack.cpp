@@ -146,6 +146,18 @@ TEST_CASE("StackAllocator properties", "[stack]")
     REQUIRE(stack.available() == capacity);
 }
 
+TEST_CASE("StackAllocator odd capacity", "[stack]")
+{
+    // Not a multiple of the buffer alignment
+    StackAllocator stack(1001);
+
+    REQUIRE(stack.capacity() == 1001);
+    void* ptr = stack.allocate(1001, 1);
+    REQUIRE(ptr != nullptr);
+    REQUIRE(reinterpret_cast<std::uintptr_t>(ptr) % alignof(std::max_align_t) == 0);
+    REQUIRE(stack.allocate(1, 1) == nullptr);
+}
+
 TEST_CASE("StackAllocator marker validation", "[stack]")
 {
     StackAllocator stack(1024);
@@ -171,3 +183,25 @@ TEST_CASE("StackAllocator zero-size allocation", "[stack]")
     REQUIRE(ptr != nullptr);
     REQUIRE(stack.used() == used_before);
 }
+
+TEST_CASE("StackAllocator in-place growth", "[stack]")
+{
+    StackAllocator stack(1024);
+
+    void* first = stack.allocate(100, 16);
+    REQUIRE(stack.try_grow(first, 100, 300));
+    REQUIRE(stack.used() == 300);
+
+    // Shrinking the top allocation gives the space back
+    REQUIRE(stack.try_grow(first, 300, 200));
+    REQUIRE(stack.used() == 200);
+
+    // Only the top allocation can change size
+    void* second = stack.allocate(100, 16);
+    REQUIRE_FALSE(stack.try_grow(first, 200, 250));
+    REQUIRE(stack.try_grow(second, 100, 200));
+
+    // Not enough room left
+    REQUIRE_FALSE(stack.try_grow(second, 200, 2000));
+    REQUIRE(stack.used() == 208 + 200);
+}
@@ -0,0 +1,119 @@
+#include <catch2/catch_test_macros.hpp>
+#include "string_interner.h"
+#include <string>
+#include <vector>
+
+using namespace fast_alloc;
+
+TEST_CASE("StringInterner deduplication", "[string_interner]")
+{
+    StringInterner interner;
+
+    const StringId a = interner.intern("service.latency");
+    const StringId b = interner.intern("service.errors");
+    const StringId c = interner.intern(std::string("service.") + "latency");
+
+    REQUIRE(a != b);
+    REQUIRE(a == c);
+    REQUIRE(interner.size() == 2);
+    REQUIRE(interner.view(a) == "service.latency");
+    REQUIRE(interner.view(b) == "service.errors");
+}
+
+TEST_CASE("StringInterner zero-copy views", "[string_interner]")
+{
+    StringInterner interner;
+
+    const StringId id = interner.intern("region=eu-west");
+    const std::string_view first = interner.view(id);
+
+    // Later inserts never move existing bytes
+    for (int i = 0; i < 1000; ++i)
+    {
+        interner.intern("label-" + std::to_string(i));
+    }
+
+    REQUIRE(interner.view(id).data() == first.data());
+    REQUIRE(first == "region=eu-west");
+    REQUIRE(first.data()[first.size()] == '\0');
+}
+
+TEST_CASE("StringInterner find", "[string_interner]")
+{
+    StringInterner interner;
+
+    REQUIRE(interner.find("missing") == StringInterner::invalid_id);
+
+    const StringId id = interner.intern("present");
+    REQUIRE(interner.find("present") == id);
+    REQUIRE(interner.find("missing") == StringInterner::invalid_id);
+    REQUIRE(interner.size() == 1);
+}
+
+TEST_CASE("StringInterner empty string", "[string_interner]")
+{
+    StringInterner interner;
+
+    const StringId id = interner.intern("");
+    REQUIRE(interner.intern("") == id);
+    REQUIRE(interner.view(id).empty());
+}
+
+TEST_CASE("StringInterner table growth", "[string_interner]")
+{
+    StringInterner interner(256, 4);
+
+    std::vector<StringId> ids;
+    for (int i = 0; i < 5000; ++i)
+    {
+        ids.push_back(interner.intern("key" + std::to_string(i)));
+    }
+
+    REQUIRE(interner.size() == 5000);
+    REQUIRE(interner.page_count() > 1);
+
+    for (int i = 0; i < 5000; ++i)
+    {
+        REQUIRE(interner.intern("key" + std::to_string(i)) == ids[static_cast<std::size_t>(i)]);
+        REQUIRE(interner.view(ids[static_cast<std::size_t>(i)]) == "key" + std::to_string(i));
+    }
+}
+
+TEST_CASE("StringInterner oversized strings", "[string_interner]")
+{
+    StringInterner interner(64);
+
+    const std::string long_string(1000, 'x');
+    const StringId small_before = interner.intern("small");
+    const StringId big = interner.intern(long_string);
+    const StringId small_after = interner.intern("tiny");
+
+    REQUIRE(interner.view(big) == long_string);
+    REQUIRE(interner.view(small_before) == "small");
+    REQUIRE(interner.view(small_after) == "tiny");
+    REQUIRE(interner.bytes_used() == 6 + 1001 + 5);
+}
+
+TEST_CASE("StringInterner clear", "[string_interner]")
+{
+    StringInterner interner(128);
+
+    for (int i = 0; i < 100; ++i)
+    {
+        interner.intern("value" + std::to_string(i));
+    }
+    const std::size_t pages = interner.page_count();
+
+    interner.clear();
+    REQUIRE(interner.size() == 0);
+    REQUIRE(interner.bytes_used() == 0);
+    REQUIRE(interner.find("value1") == StringInterner::invalid_id);
+
+    // Pages are reused rather than reallocated
+    for (int i = 0; i < 100; ++i)
+    {
+        interner.intern("value" + std::to_string(i));
+    }
+    REQUIRE(interner.page_count() == pages);
+    REQUIRE(interner.view(interner.find("value42")) == "value42");
+}
@@ -100,6 +100,30 @@ TEST_CASE("ThreadSafePoolAllocator properties", "[threadsafe_pool]")
     REQUIRE_FALSE(pool.is_full());
 }
 
+TEST_CASE("ThreadSafePoolAllocator custom alignment", "[threadsafe_pool]")
+{
+    ThreadSafePoolAllocator pool(40, 16, 64);
+
+    REQUIRE(pool.block_size() == 40);
+    REQUIRE(pool.block_stride() == 64);
+    REQUIRE(pool.alignment() == 64);
+
+    std::vector<void*> ptrs;
+    for (std::size_t i = 0; i < 16; ++i)
+    {
+        void* ptr = pool.allocate();
+        REQUIRE(ptr != nullptr);
+        REQUIRE(reinterpret_cast<std::uintptr_t>(ptr) % 64 == 0);
+        ptrs.push_back(ptr);
+    }
+
+    for (void* ptr : ptrs)
+    {
+        pool.deallocate(ptr);
+    }
+    REQUIRE(pool.allocated() == 0);
+}
+
 TEST_CASE("ThreadSafePoolAllocator concurrent allocations", "[threadsafe_pool]")
 {
     constexpr std::size_t num_threads = 4;
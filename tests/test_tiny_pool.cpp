@@ -0,0 +1,142 @@
+#include <catch2/catch_test_macros.hpp>
+#include "tiny_pool_allocator.h"
+#include <cstring>
+#include <vector>
+
+using namespace fast_alloc;
+
+TEST_CASE("TinyPoolAllocator basic allocation", "[tiny_pool]")
+{
+    TinyPoolAllocator pool(2, 10);
+
+    SECTION("Single allocation")
+    {
+        void* ptr = pool.allocate();
+        REQUIRE(ptr != nullptr);
+        REQUIRE(pool.allocated() == 1);
+
+        pool.deallocate(ptr);
+        REQUIRE(pool.allocated() == 0);
+    }
+
+    SECTION("Blocks are densely packed")
+    {
+        auto* p1 = static_cast<std::byte*>(pool.allocate());
+        auto* p2 = static_cast<std::byte*>(pool.allocate());
+        auto* p3 = static_cast<std::byte*>(pool.allocate());
+
+        REQUIRE(p2 == p1 + 2);
+        REQUIRE(p3 == p2 + 2);
+
+        pool.deallocate(p1);
+        pool.deallocate(p2);
+        pool.deallocate(p3);
+        REQUIRE(pool.allocated() == 0);
+    }
+}
+
+TEST_CASE("TinyPoolAllocator single byte blocks", "[tiny_pool]")
+{
+    constexpr std::size_t count = 200; // Spans several bitmap words
+    TinyPoolAllocator pool(1, count);
+
+    std::vector<unsigned char*> ptrs;
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        auto* ptr = static_cast<unsigned char*>(pool.allocate());
+        REQUIRE(ptr != nullptr);
+        *ptr = static_cast<unsigned char>(i);
+        ptrs.push_back(ptr);
+    }
+
+    REQUIRE(pool.is_full());
+    REQUIRE(pool.allocate() == nullptr);
+
+    // Freeing never writes into blocks, so neighbours keep their values
+    pool.deallocate(ptrs[10]);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        REQUIRE(*ptrs[i] == static_cast<unsigned char>(i));
+    }
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        if (i != 10)
+        {
+            pool.deallocate(ptrs[i]);
+        }
+    }
+    REQUIRE(pool.allocated() == 0);
+}
+
+TEST_CASE("TinyPoolAllocator reuses lowest free block", "[tiny_pool]")
+{
+    TinyPoolAllocator pool(6, 130);
+
+    std::vector<void*> ptrs;
+    for (std::size_t i = 0; i < 130; ++i)
+    {
+        ptrs.push_back(pool.allocate());
+    }
+
+    pool.deallocate(ptrs[100]);
+    pool.deallocate(ptrs[3]);
+    pool.deallocate(ptrs[70]);
+
+    REQUIRE(pool.allocate() == ptrs[3]);
+    REQUIRE(pool.allocate() == ptrs[70]);
+    REQUIRE(pool.allocate() == ptrs[100]);
+    REQUIRE(pool.is_full());
+
+    for (void* ptr : ptrs)
+    {
+        pool.deallocate(ptr);
+    }
+}
+
+TEST_CASE("TinyPoolAllocator unaligned record access", "[tiny_pool]")
+{
+    TinyPoolAllocator pool(6, 4);
+
+    void* a = pool.allocate();
+    void* b = pool.allocate();
+
+    constexpr std::uint32_t id = 0xDEADBEEF;
+    constexpr std::uint16_t flags = 0x1234;
+    std::memcpy(b, &id, sizeof(id));
+    std::memcpy(static_cast<std::byte*>(b) + sizeof(id), &flags, sizeof(flags));
+
+    std::uint32_t read_id = 0;
+    std::uint16_t read_flags = 0;
+    std::memcpy(&read_id, b, sizeof(read_id));
+    std::memcpy(&read_flags, static_cast<std::byte*>(b) + sizeof(read_id), sizeof(read_flags));
+
+    REQUIRE(read_id == id);
+    REQUIRE(read_flags == flags);
+
+    pool.deallocate(a);
+    pool.deallocate(b);
+}
+
+TEST_CASE("TinyPoolAllocator move semantics", "[tiny_pool]")
+{
+    TinyPoolAllocator pool1(4, 10);
+    void* ptr = pool1.allocate();
+    REQUIRE(ptr != nullptr);
+
+    TinyPoolAllocator pool2(std::move(pool1));
+    REQUIRE(pool2.allocated() == 1);
+    REQUIRE(pool2.capacity() == 10);
+    REQUIRE(pool2.block_size() == 4);
+
+    pool2.deallocate(ptr);
+    REQUIRE(pool2.allocated() == 0);
+}
+
+TEST_CASE("TinyPoolAllocator nullptr handling", "[tiny_pool]")
+{
+    TinyPoolAllocator pool(3, 5);
+
+    pool.deallocate(nullptr);
+    REQUIRE(pool.allocated() == 0);
+}